@@ -2,7 +2,7 @@
 #!/bin/sh
 
 
-make
+make all bench-generator
 
 cd ./tests
 python3 ./.tester.py --settings ./.settings.json
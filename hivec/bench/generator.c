@@ -0,0 +1,398 @@
+/**
+ * @file generator.c
+ *
+ * @copyright This file is a part of the project hivelang and is distributed under MIT license that
+ * should have been included with the project. If not, see https://choosealicense.com/licenses/mit/
+ *
+ * @author joba14
+ *
+ * @date 2022-09-10
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+
+// NOTES:
+//     1. Generator of synthetic hivelang corpora for the front-end benchmarks. Every generated
+//        procedure requires and returns one i64, and every statement keeps that single i64 on
+//        the stack, so the corpus passes the whole front-end (it is not meant to be run, the
+//        loops are not guaranteed to terminate).
+//     2. The failing procedures start their bodies with dropping more values, than there are
+//        on the stack, so the corpus is rejected by the validator. The tests use them to check,
+//        that the diagnostics of the big modules do not depend on the threads count.
+//     3. Usage: bench-generator [options]. See `Generator_usage` for the options.
+
+#define GENERATOR_MAXIMAL_FAILING_COUNT 8
+
+struct GeneratorOptions
+{
+	int64_t procedures;
+	int64_t tokens; // per procedure's body, at least
+	int64_t strings; // percent of the statements
+	int64_t literals; // percent of the statements
+	int64_t depth; // maximal nesting of the blocks
+	int64_t seed;
+	int64_t failing[GENERATOR_MAXIMAL_FAILING_COUNT]; // indices of the failing procedures
+	int64_t failingCount;
+	const char* output;
+};
+
+struct Generator
+{
+	struct GeneratorOptions options;
+	FILE* stream;
+	uint64_t state;
+	int64_t procedure; // currently generated one
+	int64_t tokens; // generated in the current procedure's body
+};
+
+static void Generator_usage(
+	FILE* const stream,
+	const char* argv0);
+
+static signed char Generator_parseNumber(
+	const char* text,
+	int64_t* const number);
+
+static uint64_t Generator_random(
+	struct Generator* const generator,
+	const uint64_t bound);
+
+static void Generator_indent(
+	struct Generator* const generator,
+	const int64_t depth);
+
+static void Generator_literal(
+	struct Generator* const generator);
+
+static void Generator_string(
+	struct Generator* const generator);
+
+static void Generator_block(
+	struct Generator* const generator,
+	const int64_t depth,
+	const int64_t statements);
+
+static void Generator_statement(
+	struct Generator* const generator,
+	const int64_t depth);
+
+int main(
+	int argc,
+	char** argv)
+{
+	struct GeneratorOptions options =
+	{
+		.procedures = 10000,
+		.tokens = 64,
+		.strings = 10,
+		.literals = 40,
+		.depth = 3,
+		.seed = 14,
+		.failing = {0},
+		.failingCount = 0,
+		.output = NULL
+	};
+
+	for (int index = 1; index < argc; ++index)
+	{
+		const char* flag = argv[index];
+		int64_t* number = NULL;
+
+		if (strcmp(flag, "--help") == 0 || strcmp(flag, "-h") == 0)
+		{
+			Generator_usage(stdout, argv[0]);
+			return 0;
+		}
+
+		if (index + 1 >= argc)
+		{
+			fprintf(stderr, "[generator]: error: no value provided for flag `%s`!\n", flag);
+			Generator_usage(stderr, argv[0]);
+			return 1;
+		}
+
+		const char* value = argv[++index];
+
+		if (strcmp(flag, "--output") == 0 || strcmp(flag, "-o") == 0)
+		{
+			options.output = value;
+			continue;
+		}
+		else if (strcmp(flag, "--procedures") == 0) { number = &options.procedures; }
+		else if (strcmp(flag, "--tokens") == 0) { number = &options.tokens; }
+		else if (strcmp(flag, "--strings") == 0) { number = &options.strings; }
+		else if (strcmp(flag, "--literals") == 0) { number = &options.literals; }
+		else if (strcmp(flag, "--depth") == 0) { number = &options.depth; }
+		else if (strcmp(flag, "--seed") == 0) { number = &options.seed; }
+		else if (strcmp(flag, "--failing") == 0 && options.failingCount < GENERATOR_MAXIMAL_FAILING_COUNT) { number = &options.failing[options.failingCount++]; }
+
+		if (number == NULL || !Generator_parseNumber(value, number))
+		{
+			fprintf(stderr, "[generator]: error: invalid flag `%s` or its value `%s`!\n", flag, value);
+			Generator_usage(stderr, argv[0]);
+			return 1;
+		}
+	}
+
+	if (options.procedures <= 0 || options.strings + options.literals > 100)
+	{
+		fprintf(stderr, "[generator]: error: procedures must be positive and strings and literals must not exceed 100 percent together!\n");
+		return 1;
+	}
+
+	for (int64_t index = 0; index < options.failingCount; ++index)
+	{
+		if (options.failing[index] >= options.procedures)
+		{
+			fprintf(stderr, "[generator]: error: failing procedure %ld is out of the procedures count!\n", options.failing[index]);
+			return 1;
+		}
+	}
+
+	struct Generator generator = {0};
+	generator.options = options;
+	generator.state = (uint64_t)options.seed * 0x9e3779b97f4a7c15ULL + 1;
+	generator.stream = options.output != NULL ? fopen(options.output, "w") : stdout;
+
+	if (generator.stream == NULL)
+	{
+		fprintf(stderr, "[generator]: error: failed to open output file `%s`!\n", options.output);
+		return 1;
+	}
+
+	fprintf(generator.stream, "// Generated by bench-generator: --procedures %ld --tokens %ld --strings %ld --literals %ld --depth %ld --seed %ld\n\n",
+		options.procedures, options.tokens, options.strings, options.literals, options.depth, options.seed);
+
+	for (int64_t index = 0; index < options.failingCount; ++index)
+	{
+		fprintf(generator.stream, "// Failing procedure: generated_%ld\n", options.failing[index]);
+	}
+
+	if (options.failingCount > 0)
+	{
+		fputc('\n', generator.stream);
+	}
+
+	for (generator.procedure = 0; generator.procedure < options.procedures; ++generator.procedure)
+	{
+		fprintf(generator.stream, "procedure generated_%ld\n\trequire i64\n\treturn i64\ndo\n", generator.procedure);
+
+		for (int64_t index = 0; index < options.failingCount; ++index)
+		{
+			if (options.failing[index] == generator.procedure)
+			{
+				// Dropping the required i64 and then the value, that is not there
+				fprintf(generator.stream, "\tdrop drop\n");
+				break;
+			}
+		}
+
+		for (generator.tokens = 0; generator.tokens < options.tokens;)
+		{
+			Generator_statement(&generator, 1);
+		}
+
+		fprintf(generator.stream, "end\n\n");
+	}
+
+	fprintf(generator.stream, "procedure main\n\trequire i64 p64\n\treturn i64\ndo\n\tdrop drop 0 generated_%ld\nend\n", options.procedures - 1);
+
+	if (generator.stream != stdout)
+	{
+		fclose(generator.stream);
+	}
+
+	return 0;
+}
+
+static void Generator_usage(
+	FILE* const stream,
+	const char* argv0)
+{
+	fprintf(stream,
+		"Usage: %s [Options]\n"
+		"Options:\n"
+		"    [ --output       | -o  ] <path>         Set output path for the corpus (stdout by default)\n"
+		"    [ --procedures         ] <count>        Set procedures count (10000 by default)\n"
+		"    [ --tokens             ] <count>        Set minimal tokens count per procedure's body (64 by default)\n"
+		"    [ --strings            ] <percent>      Set percent of string literal statements (10 by default)\n"
+		"    [ --literals           ] <percent>      Set percent of numerical literal statements (40 by default)\n"
+		"    [ --depth              ] <count>        Set maximal nesting of if and while blocks (3 by default)\n"
+		"    [ --seed               ] <number>       Set seed of the generated corpus (14 by default)\n"
+		"    [ --failing            ] <index>        Make the procedure fail the validation (repeatable, up to 8)\n"
+		"    [ --help         | -h  ]                Print usage message\n",
+		argv0);
+}
+
+static signed char Generator_parseNumber(
+	const char* text,
+	int64_t* const number)
+{
+	assert(text != NULL);
+	assert(number != NULL);
+
+	char* end = NULL;
+	const long long value = strtoll(text, &end, 10);
+
+	if (end == text || *end != 0 || value < 0)
+	{
+		return 0;
+	}
+
+	*number = (int64_t)value;
+	return 1;
+}
+
+static uint64_t Generator_random(
+	struct Generator* const generator,
+	const uint64_t bound)
+{
+	assert(generator != NULL);
+	assert(bound > 0);
+
+	// xorshift64*, the corpus only depends on the seed
+	generator->state ^= generator->state >> 12;
+	generator->state ^= generator->state << 25;
+	generator->state ^= generator->state >> 27;
+	return (generator->state * 0x2545f4914f6cdd1dULL) % bound;
+}
+
+static void Generator_indent(
+	struct Generator* const generator,
+	const int64_t depth)
+{
+	assert(generator != NULL);
+
+	for (int64_t level = 0; level < depth; ++level)
+	{
+		fputc('\t', generator->stream);
+	}
+}
+
+static void Generator_literal(
+	struct Generator* const generator)
+{
+	assert(generator != NULL);
+
+	// Mixing all forms, that the literals decoder supports
+	const uint64_t value = Generator_random(generator, 1000000);
+
+	switch (Generator_random(generator, 5))
+	{
+		case 0: { fprintf(generator->stream, "0x%lx", value); } break;
+		case 1: { fprintf(generator->stream, "0b%lu%lu%lu%lu", value & 1, (value >> 1) & 1, (value >> 2) & 1, (value >> 3) & 1); } break;
+		case 2: { fprintf(generator->stream, "%lu_%03lu", value / 1000, value % 1000); } break;
+		case 3: { fprintf(generator->stream, "-%lu", value); } break;
+		default: { fprintf(generator->stream, "%lu", value); } break;
+	}
+
+	++generator->tokens;
+}
+
+static void Generator_string(
+	struct Generator* const generator)
+{
+	assert(generator != NULL);
+
+	static const char* const words[] =
+	{
+		"hello", "world", "lexer", "token", "stream", "value", "\\n", "\\t", "\\\"quoted\\\"", "it\\'s"
+	};
+
+	const uint64_t wordsCount = sizeof(words) / sizeof(words[0]);
+	const uint64_t count = 1 + Generator_random(generator, 8);
+
+	fputc('"', generator->stream);
+
+	for (uint64_t index = 0; index < count; ++index)
+	{
+		fprintf(generator->stream, index > 0 ? " %s" : "%s", words[Generator_random(generator, wordsCount)]);
+	}
+
+	fputc('"', generator->stream);
+	++generator->tokens;
+}
+
+static void Generator_block(
+	struct Generator* const generator,
+	const int64_t depth,
+	const int64_t statements)
+{
+	assert(generator != NULL);
+
+	for (int64_t statement = 0; statement < statements; ++statement)
+	{
+		Generator_statement(generator, depth);
+	}
+}
+
+static void Generator_statement(
+	struct Generator* const generator,
+	const int64_t depth)
+{
+	assert(generator != NULL);
+
+	static const char* const operators[] = { "add", "subtract", "multiply", "band", "bor" };
+	const uint64_t operatorsCount = sizeof(operators) / sizeof(operators[0]);
+	const uint64_t roll = Generator_random(generator, 100);
+	const int64_t strings = generator->options.strings;
+	const int64_t literals = generator->options.literals;
+
+	Generator_indent(generator, depth);
+
+	// NOTE: every statement keeps the single i64 on the stack, so they can be freely nested
+	//       and sequenced.
+	if ((int64_t)roll < strings)
+	{
+		Generator_string(generator);
+		fprintf(generator->stream, " drop drop\n");
+		generator->tokens += 2;
+	}
+	else if ((int64_t)roll < strings + literals)
+	{
+		Generator_literal(generator);
+		fprintf(generator->stream, " %s\n", operators[Generator_random(generator, operatorsCount)]);
+		++generator->tokens;
+	}
+	else if ((int64_t)roll < strings + literals + 10 && depth <= generator->options.depth)
+	{
+		const signed char isWhile = Generator_random(generator, 2) == 0;
+		fprintf(generator->stream, isWhile ? "while clone " : "if clone ");
+		Generator_literal(generator);
+		fprintf(generator->stream, " less do\n");
+		generator->tokens += 4;
+
+		Generator_block(generator, depth + 1, 1 + (int64_t)Generator_random(generator, 3));
+
+		if (!isWhile && Generator_random(generator, 2) == 0)
+		{
+			Generator_indent(generator, depth);
+			fprintf(generator->stream, "else\n");
+			++generator->tokens;
+			Generator_block(generator, depth + 1, 1 + (int64_t)Generator_random(generator, 3));
+		}
+
+		Generator_indent(generator, depth);
+		fprintf(generator->stream, "end\n");
+		++generator->tokens;
+	}
+	else if ((int64_t)roll < strings + literals + 20 && generator->procedure > 0)
+	{
+		fprintf(generator->stream, "generated_%lu\n", Generator_random(generator, (uint64_t)generator->procedure));
+		++generator->tokens;
+	}
+	else if ((int64_t)roll < strings + literals + 30)
+	{
+		// Comments produce no tokens, but the lexer still has to skip them
+		fprintf(generator->stream, "// Keeping the value on the stack\n");
+	}
+	else
+	{
+		fprintf(generator->stream, "clone %s\n", operators[Generator_random(generator, operatorsCount)]);
+		generator->tokens += 2;
+	}
+}
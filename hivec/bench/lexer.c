@@ -0,0 +1,155 @@
+/**
+ * @file lexer.c
+ *
+ * @copyright This file is a part of the project hivelang and is distributed under MIT license that
+ * should have been included with the project. If not, see https://choosealicense.com/licenses/mit/
+ *
+ * @author joba14
+ *
+ * @date 2022-09-10
+ */
+
+#include <types.h>
+#include <scanner.h>
+#include <lexer.h>
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+// NOTES:
+//     1. Throughput benchmark of the `Lexer_lexFile`, including the loading of the source, the
+//        interning of the symbols, and the validation of the tokens, the same way the compiler
+//        runs it. Every source is lexed repeatedly and the best run is reported.
+//     2. Usage: bench-lexer [--repetitions <count>] sources... The sources can be generated
+//        with the bench-generator.
+
+#define BENCH_DEFAULT_REPETITIONS ((int64_t)5)
+
+static signed char Bench_lexSource(
+	const char* file,
+	int64_t* const tokensCount,
+	int64_t* const bytesCount,
+	double* const seconds);
+
+static void Bench_flushLogs(
+	struct Queue* const logs,
+	const signed char print);
+
+static double Bench_seconds(
+	void);
+
+int main(
+	int argc,
+	char** argv)
+{
+	int64_t repetitions = BENCH_DEFAULT_REPETITIONS;
+	int first = 1;
+
+	if (argc > 2 && strcmp(argv[1], "--repetitions") == 0)
+	{
+		repetitions = (int64_t)strtoll(argv[2], NULL, 10);
+		first = 3;
+	}
+
+	if (first >= argc || repetitions <= 0)
+	{
+		fprintf(stderr, "Usage: %s [--repetitions <count>] sources...\n", argv[0]);
+		return 1;
+	}
+
+	const enum ScannerLevel level = Scanner_initialize();
+	printf("[bench]: lexing with %s kernels, best of %ld run(s) per source\n", Scanner_stringifyLevel(level), repetitions);
+
+	for (int index = first; index < argc; ++index)
+	{
+		int64_t tokensCount = 0;
+		int64_t bytesCount = 0;
+		double best = 0.0;
+
+		for (int64_t repetition = 0; repetition < repetitions; ++repetition)
+		{
+			double seconds = 0.0;
+
+			if (!Bench_lexSource(argv[index], &tokensCount, &bytesCount, &seconds))
+			{
+				fprintf(stderr, "[bench]: error: failed to lex source file `%s`!\n", argv[index]);
+				return 1;
+			}
+
+			best = repetition == 0 || seconds < best ? seconds : best;
+		}
+
+		printf("[bench]: %s: %ld bytes, %ld tokens, %.3f ms, %.1f Mtokens/s, %.1f MB/s\n", argv[index], bytesCount, tokensCount,
+			best * 1e3, (double)tokensCount / best / 1e6, (double)bytesCount / best / (1024.0 * 1024.0));
+	}
+
+	// NOTE: on Linux the `ru_maxrss` is in kilobytes.
+	struct rusage usage = {0};
+	getrusage(RUSAGE_SELF, &usage);
+	printf("[bench]: peak RSS %.1f MB\n", (double)usage.ru_maxrss / 1024.0);
+	return 0;
+}
+
+static signed char Bench_lexSource(
+	const char* file,
+	int64_t* const tokensCount,
+	int64_t* const bytesCount,
+	double* const seconds)
+{
+	assert(file != NULL);
+	assert(tokensCount != NULL);
+	assert(bytesCount != NULL);
+	assert(seconds != NULL);
+
+	struct Queue logs = Queue_create(NULL);
+	struct Arena arena = Arena_create();
+	struct Source source = Source_create(file);
+	struct Tokens tokens = Tokens_create(&arena, &source);
+
+	const double begin = Bench_seconds();
+	const signed char lexed = Lexer_lexFile(&source, &tokens, NULL, (int64_t)sysconf(_SC_NPROCESSORS_ONLN), &logs);
+	*seconds = Bench_seconds() - begin;
+
+	*tokensCount = tokens.count;
+	*bytesCount = source.length;
+
+	// Only the failures are worth printing, the lexer logs nothing else
+	Bench_flushLogs(&logs, !lexed);
+	Queue_destroy(&logs);
+	Arena_destroy(&arena);
+	Source_destroy(&source);
+	return lexed;
+}
+
+static void Bench_flushLogs(
+	struct Queue* const logs,
+	const signed char print)
+{
+	assert(logs != NULL);
+
+	struct Log* log = NULL;
+
+	while ((log = (struct Log*)Queue_dequeue(logs)) != NULL)
+	{
+		if (print)
+		{
+			Log_print(log);
+		}
+
+		Log_destroy(log);
+	}
+}
+
+static double Bench_seconds(
+	void)
+{
+	struct timespec now = {0};
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
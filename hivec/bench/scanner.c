@@ -0,0 +1,332 @@
+/**
+ * @file scanner.c
+ *
+ * @copyright This file is a part of the project hivelang and is distributed under MIT license that
+ * should have been included with the project. If not, see https://choosealicense.com/licenses/mit/
+ *
+ * @author joba14
+ *
+ * @date 2022-09-10
+ */
+
+#include <scanner.h>
+
+#include <assert.h>
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#	include <x86intrin.h>
+#endif
+
+// NOTES:
+//     1. Microbenchmark of the lexer's scanning kernels. It walks the sources the same way the
+//        lexer does (whitespace, identifier prefix, rest of the word, comments up to the end
+//        of the line) with every kernels level, that the running CPU supports, and with the
+//        `isalpha`/`isdigit` classification, that the lexer used before the scanner, as the
+//        baseline.
+//     2. Usage: bench-scanner [sources...]. Without sources a synthetic one is generated.
+
+#define BENCH_SYNTHETIC_PROCEDURES ((int64_t)20000)
+#define BENCH_MINIMAL_BYTES ((int64_t)(64 * 1024 * 1024))
+
+static char* Bench_loadFile(
+	const char* filePath,
+	int64_t* const length);
+
+static char* Bench_generateSource(
+	int64_t* const length);
+
+static uint64_t Bench_scan(
+	const char* begin,
+	const char* const end);
+
+static uint64_t Bench_scanBaseline(
+	const char* begin,
+	const char* const end);
+
+static void Bench_report(
+	const char* const name,
+	uint64_t (*scan)(const char*, const char* const),
+	const char* const source,
+	const int64_t length,
+	const int64_t repetitions);
+
+static uint64_t Bench_cycles(
+	void);
+
+static double Bench_seconds(
+	void);
+
+int main(
+	int argc,
+	char** argv)
+{
+	int64_t length = 0;
+	char* source = NULL;
+
+	if (argc > 1)
+	{
+		for (int index = 1; index < argc; ++index)
+		{
+			int64_t fileLength = 0;
+			char* file = Bench_loadFile(argv[index], &fileLength);
+
+			if (file == NULL)
+			{
+				fprintf(stderr, "[bench]: error: failed to read source file `%s`!\n", argv[index]);
+				free(source);
+				return 1;
+			}
+
+			source = (char*)realloc(source, (size_t)(length + fileLength + 1));
+			assert(source != NULL);
+			memcpy(source + length, file, (size_t)fileLength);
+			source[length + fileLength] = '\n';
+			length += fileLength + 1;
+			free(file);
+		}
+	}
+	else
+	{
+		source = Bench_generateSource(&length);
+	}
+
+	if (length <= 0)
+	{
+		fprintf(stderr, "[bench]: error: nothing to scan!\n");
+		free(source);
+		return 1;
+	}
+
+	// Small sources are scanned repeatedly, so every level is timed over enough bytes
+	const int64_t repetitions = length >= BENCH_MINIMAL_BYTES ? 1 : (BENCH_MINIMAL_BYTES + length - 1) / length;
+	printf("[bench]: scanning %ld bytes %ld time(s) per level\n", length, repetitions);
+
+	// The baseline's count of the words is the one, that every level must find
+	const uint64_t expected = Bench_scanBaseline(source, source + length);
+	Bench_report("ctype", Bench_scanBaseline, source, length, repetitions);
+
+	for (int64_t level = SCANNER_LEVEL_SCALAR; level < SCANNER_LEVELS_COUNT; ++level)
+	{
+		if (!Scanner_select((enum ScannerLevel)level))
+		{
+			printf("[bench]: %-8s unsupported\n", Scanner_stringifyLevel((enum ScannerLevel)level));
+			continue;
+		}
+
+		const uint64_t words = Bench_scan(source, source + length);
+
+		if (words != expected)
+		{
+			fprintf(stderr, "[bench]: error: %s kernels found %lu words instead of %lu!\n", Scanner_stringifyLevel((enum ScannerLevel)level), words, expected);
+			free(source);
+			return 1;
+		}
+
+		Bench_report(Scanner_stringifyLevel((enum ScannerLevel)level), Bench_scan, source, length, repetitions);
+	}
+
+	free(source);
+	return 0;
+}
+
+static char* Bench_loadFile(
+	const char* filePath,
+	int64_t* const length)
+{
+	assert(filePath != NULL);
+	assert(length != NULL);
+
+	FILE* file = fopen(filePath, "rb");
+
+	if (file == NULL)
+	{
+		return NULL;
+	}
+
+	int64_t capacity = 64 * 1024;
+	char* buffer = (char*)malloc((size_t)capacity);
+	assert(buffer != NULL);
+	*length = 0;
+
+	for (size_t bytesRead = 0; (bytesRead = fread(buffer + *length, 1, (size_t)(capacity - *length), file)) > 0;)
+	{
+		*length += (int64_t)bytesRead;
+
+		if (*length >= capacity)
+		{
+			capacity *= 2;
+			buffer = (char*)realloc(buffer, (size_t)capacity);
+			assert(buffer != NULL);
+		}
+	}
+
+	fclose(file);
+	return buffer;
+}
+
+static char* Bench_generateSource(
+	int64_t* const length)
+{
+	assert(length != NULL);
+
+	static const char* const procedure =
+		"procedure print_range_%ld\n"
+		"\trequire i64 i64\n"
+		"do\n"
+		"\twhile over over less do\n"
+		"\t\tswap\n"
+		"\t\tclone printn // Printing the current value\n"
+		"\t\t1 add\n"
+		"\t\tswap\n"
+		"\tend drop drop\n"
+		"end\n"
+		"\n";
+
+	const int64_t capacity = BENCH_SYNTHETIC_PROCEDURES * (int64_t)(strlen(procedure) + 32);
+	char* buffer = (char*)malloc((size_t)capacity);
+	assert(buffer != NULL);
+	*length = 0;
+
+	for (int64_t index = 0; index < BENCH_SYNTHETIC_PROCEDURES; ++index)
+	{
+		*length += snprintf(buffer + *length, (size_t)(capacity - *length), procedure, index);
+	}
+
+	return buffer;
+}
+
+static uint64_t Bench_scan(
+	const char* begin,
+	const char* const end)
+{
+	uint64_t words = 0;
+
+	while (begin < end)
+	{
+		begin = Scanner_skipWhitespace(begin, end);
+
+		if (begin >= end)
+		{
+			break;
+		}
+
+		if (end - begin > 1 && begin[0] == '/' && begin[1] == '/')
+		{
+			const char* newline = (const char*)memchr(begin, '\n', (size_t)(end - begin));
+			begin = newline != NULL ? newline : end;
+			continue;
+		}
+
+		begin = Scanner_skipWord(Scanner_skipIdentifier(begin, end), end);
+		++words;
+	}
+
+	return words;
+}
+
+static signed char Bench_isWhitespace(
+	const char ch)
+{
+	return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r' ? 1 : 0;
+}
+
+static signed char Bench_isIdentifierChar(
+	const char ch)
+{
+	return ch == '_' || ch == '?' || isalpha((unsigned char)ch) || isdigit((unsigned char)ch);
+}
+
+static uint64_t Bench_scanBaseline(
+	const char* begin,
+	const char* const end)
+{
+	uint64_t words = 0;
+
+	while (begin < end)
+	{
+		while (begin < end && Bench_isWhitespace(*begin))
+		{
+			++begin;
+		}
+
+		if (begin >= end)
+		{
+			break;
+		}
+
+		if (end - begin > 1 && begin[0] == '/' && begin[1] == '/')
+		{
+			const char* newline = (const char*)memchr(begin, '\n', (size_t)(end - begin));
+			begin = newline != NULL ? newline : end;
+			continue;
+		}
+
+		while (begin < end && Bench_isIdentifierChar(*begin))
+		{
+			++begin;
+		}
+
+		while (begin < end && !Bench_isWhitespace(*begin))
+		{
+			++begin;
+		}
+
+		++words;
+	}
+
+	return words;
+}
+
+static void Bench_report(
+	const char* const name,
+	uint64_t (*scan)(const char*, const char* const),
+	const char* const source,
+	const int64_t length,
+	const int64_t repetitions)
+{
+	// Keeping the repeated scans from being optimized away
+	volatile uint64_t sink = 0;
+
+	// Warming up the caches and the branch predictors
+	sink += scan(source, source + length);
+
+	const double secondsBegin = Bench_seconds();
+	const uint64_t cyclesBegin = Bench_cycles();
+
+	for (int64_t repetition = 0; repetition < repetitions; ++repetition)
+	{
+		sink += scan(source, source + length);
+	}
+
+	const uint64_t cycles = Bench_cycles() - cyclesBegin;
+	const double seconds = Bench_seconds() - secondsBegin;
+	const double bytes = (double)length * (double)repetitions;
+
+	printf("[bench]: %-8s %8.3f bytes/cycle %10.1f MB/s\n", name,
+		cycles > 0 ? bytes / (double)cycles : 0.0, bytes / seconds / (1024.0 * 1024.0));
+
+	(void)sink;
+}
+
+static uint64_t Bench_cycles(
+	void)
+{
+#if defined(__x86_64__) && defined(__GNUC__)
+	return (uint64_t)__rdtsc();
+#else
+	return 0;
+#endif
+}
+
+static double Bench_seconds(
+	void)
+{
+	struct timespec now = {0};
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
@@ -0,0 +1,71 @@
+/**
+ * @file cache.h
+ *
+ * @copyright This file is a part of the project hivelang and is distributed under MIT license that
+ * should have been included with the project. If not, see https://choosealicense.com/licenses/mit/
+ *
+ * @author joba14
+ *
+ * @date 2022-09-26
+ */
+
+#ifndef _CACHE_H_
+#define _CACHE_H_
+
+#include <types.h>
+
+/**
+ * @addtogroup cache
+ *
+ * @{
+ */
+
+/**
+ * Version of the token cache files format. It must be bumped, whenever the layout of the
+ * `struct Tokens` columns, the token kinds, or the lexing rules change, so stale caches are
+ * never loaded. The count of the token kinds, which differs between the debug and release
+ * configurations, is checked on its own.
+ */
+#define CACHE_VERSION ((uint32_t)3)
+
+/**
+ * Key of a cached token stream: the 64-bit hash of the source's content and its length.
+ */
+struct CacheKey
+{
+	uint64_t hash;
+	int64_t length;
+};
+
+/**
+ * Hash the content of the provided (loaded) source into a cache key.
+ */
+struct CacheKey Cache_hash(
+	const struct Source* const source);
+
+/**
+ * Map the token stream, cached under the provided key in the provided directory, and point the
+ * tokens columns into the mapping, which is then owned by the source. Returns 0 in case there is
+ * no such cache or it is stale or damaged, and keeps the tokens untouched.
+ */
+signed char Cache_load(
+	const char* const directory,
+	const struct CacheKey* const key,
+	struct Source* const source,
+	struct Tokens* const tokens);
+
+/**
+ * Store the lexed token stream of the provided source under the provided key in the provided
+ * directory (creating it, if it does not exist). Returns 0 in case the cache could not be written.
+ */
+signed char Cache_store(
+	const char* const directory,
+	const struct CacheKey* const key,
+	const struct Source* const source,
+	const struct Tokens* const tokens);
+
+/**
+ * @}
+ */
+
+#endif
@@ -21,9 +21,51 @@
  * @{
  */
 
+// NOTE: pull-based lexer over the whole lines of a loaded source. It holds no tokens on its own:
+//       every `Lexer_next` lexes just the next token of the current line, and only decoded
+//       string literals are allocated (in the lexer's arena, which can be swapped between
+//       the pulls).
+struct Lexer
+{
+	struct Arena* arena;
+	const char* begin; // of the current line
+	const char* current;
+	const char* end; // of the current line
+	const char* next; // beginning of the next line
+	const char* last; // end of the lexed source
+};
+
+// NOTE: loads the source (see `Source_create`), unless it is already loaded, and points the
+//       lexer before its first line, so a source can be pulled more than once. Returns 0 (and
+//       reports it) in case the source file could not be read.
+signed char Lexer_open(
+	struct Lexer* const lexer,
+	struct Arena* const arena,
+	struct Source* const source,
+	struct Queue* const logs);
+
+// NOTE: lexes the next token into the provided one. Returns 0, when the source is exhausted.
+signed char Lexer_next(
+	struct Lexer* const lexer,
+	struct Token* const token);
+
+// NOTE: pushes the pulled token into the tokens, interning its symbol, the same way the
+//       `Lexer_lexFile` does for the whole source. Returns 0 (and reports it) in case the
+//       token is invalid.
+signed char Lexer_pushToken(
+	struct Tokens* const tokens,
+	const struct Token* const token,
+	struct Queue* const logs);
+
+// NOTE: lexes the whole source into the tokens. In case the cache directory is not null, the
+//       tokens are loaded from the cache, when the source did not change since it was stored,
+//       and are stored into the cache otherwise. Big sources are lexed on up to the threads
+//       count of threads.
 signed char Lexer_lexFile(
-	const char* filePath,
-	struct List* const tokens,
+	struct Source* const source,
+	struct Tokens* const tokens,
+	const char* const cacheDirectory,
+	const int64_t threadsCount,
 	struct Queue* const logs);
 
 /**
@@ -23,7 +23,18 @@
 
 signed char Parser_parseTokens(
 	struct Globals* const globals,
-	const struct List* const tokens,
+	struct Tokens* const tokens,
+	struct Queue* const logs);
+
+// NOTE: parses the procedure, that begins at the provided token and ends with the last one of
+//       the tokens, into its declaration, that the `Parser_parseTokens` already parsed from
+//       the procedures' signatures. The procedure's instructions are allocated in the provided
+//       arena. Returns the declaration, or null in case the procedure failed to be parsed.
+struct Procedure* Parser_parseProcedureTokens(
+	struct Globals* const globals,
+	struct Tokens* const tokens,
+	const int64_t token,
+	struct Arena* const arena,
 	struct Queue* const logs);
 
 /**
@@ -0,0 +1,105 @@
+/**
+ * @file scanner.h
+ *
+ * @copyright This file is a part of the project hivelang and is distributed under MIT license that
+ * should have been included with the project. If not, see https://choosealicense.com/licenses/mit/
+ *
+ * @author joba14
+ *
+ * @date 2022-09-10
+ */
+
+#ifndef _SCANNER_H_
+#define _SCANNER_H_
+
+#include <stdint.h>
+
+/**
+ * @addtogroup scanner
+ *
+ * @{
+ */
+
+/**
+ * Character class bit of the ' ', '\t', '\n', and '\r' characters.
+ */
+#define SCANNER_CLASS_WHITESPACE ((unsigned char)1)
+
+/**
+ * Character class bit of the characters, that identifiers are made of (letters, digits, '_',
+ * and '?').
+ */
+#define SCANNER_CLASS_IDENTIFIER ((unsigned char)2)
+
+/**
+ * Character class bit of the decimal digits.
+ */
+#define SCANNER_CLASS_DIGIT ((unsigned char)4)
+
+/**
+ * Table of the character classes bits, indexed by the unsigned value of a character.
+ */
+extern const unsigned char scannerClasses[256];
+
+/**
+ * Levels of the scanning kernels. Every level processes the same character classes, the
+ * vectorized ones just do it 16 or 32 bytes at a time.
+ */
+enum ScannerLevel
+{
+	SCANNER_LEVEL_SCALAR = 0,
+	SCANNER_LEVEL_SSE2,
+	SCANNER_LEVEL_AVX2,
+	SCANNER_LEVELS_COUNT
+};
+
+/**
+ * Select the best scanning kernels, that the running CPU supports. Until this is called the
+ * scalar kernels are used.
+ */
+enum ScannerLevel Scanner_initialize(
+	void);
+
+/**
+ * Select the scanning kernels of the provided level. Returns 0 in case the running CPU (or the
+ * build) does not support the level, and keeps the selected kernels.
+ */
+signed char Scanner_select(
+	const enum ScannerLevel level);
+
+/**
+ * Stringify the provided level.
+ */
+const char* Scanner_stringifyLevel(
+	const enum ScannerLevel level);
+
+/**
+ * Return the first non-whitespace character in range from the begin to the end (the end in case
+ * the whole range is whitespace).
+ */
+const char* Scanner_skipWhitespace(
+	const char* begin,
+	const char* const end);
+
+/**
+ * Return the first non-identifier character in range from the begin to the end (the end in case
+ * the whole range is an identifier).
+ */
+const char* Scanner_skipIdentifier(
+	const char* begin,
+	const char* const end);
+
+/**
+ * Return the first whitespace character in range from the begin to the end (the end in case the
+ * range has no whitespace).
+ */
+const char* Scanner_skipWord(
+	const char* begin,
+	const char* const end);
+
+/**
+ * @}
+ */
+
+#endif
+
@@ -15,17 +15,50 @@
 
 #include <types.h>
 
+#include <stdio.h>
+
 /**
  * @addtogroup translator
  * 
  * @{
  */
 
+// NOTE: the assembly output of one compilation unit. The procedures are translated into it one
+//       by one, so a procedure can be written out as soon as it is validated.
+struct Translator
+{
+	FILE* file;
+	int64_t stringLiteralsCount; // pooled string literals, whose data is already written
+	signed char isInData; // the data segment is the last opened one
+};
+
+// NOTE: translates all procedures of the globals, followed by the data of their string literals.
 signed char Translator_translateTokens(
 	const char* outputPath,
 	struct Globals* const globals,
 	struct Queue* const logs);
 
+// NOTE: creates the output file and writes the beginning of its text segment. Returns 0 (and
+//       reports it) in case the file could not be created.
+signed char Translator_open(
+	struct Translator* const translator,
+	const char* filePath,
+	struct Queue* const logs);
+
+void Translator_translateProcedure(
+	struct Translator* const translator,
+	const struct Globals* const globals,
+	const struct Procedure* const procedure);
+
+// NOTE: writes the data of the string literals, pooled since the previous call.
+void Translator_translateStringLiterals(
+	struct Translator* const translator,
+	const struct Globals* const globals);
+
+// NOTE: writes the bss segment and closes the output file.
+void Translator_close(
+	struct Translator* const translator);
+
 /**
  * @}
  */
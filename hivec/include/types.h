@@ -13,7 +13,7 @@
 #ifndef _TYPES_H_
 #define _TYPES_H_
 
-#include <hash256.h>
+#include <stdint.h>
 
 /**
  * @addtogroup types
@@ -21,20 +21,59 @@
  * @{
  */
 
-struct SNode
+struct ABlock
 {
-	void* data;
-	struct SNode* previous;
+	struct ABlock* previous;
+	int64_t capacity;
+	int64_t used;
+	unsigned char* data;
 };
 
+// NOTE: bump allocator for everything that lives as long as one compilation unit
+//       (tokens, procedures, container elements). Nothing is freed individually, the
+//       whole unit is released at once with `Arena_destroy`.
+struct Arena
+{
+	struct ABlock* top;
+	int64_t blockCapacity;
+};
+
+struct Arena Arena_create(
+	void);
+
+void Arena_destroy(
+	struct Arena* const arena);
+
+void* Arena_allocate(
+	struct Arena* const arena,
+	const int64_t size);
+
+// NOTE: moves all blocks of the `other` arena into the `arena`, so everything allocated in the
+//       `other` lives as long as the `arena`. The `other` is left empty.
+void Arena_adopt(
+	struct Arena* const arena,
+	struct Arena* const other);
+
+// NOTE: the containers keep their elements in one contiguous, geometrically growing array, so
+//       pushing is amortized O(1) and indexing is O(1). The grown arrays of the containers with
+//       an arena are left in it (at most doubling the memory of the elements), the others own
+//       their arrays and free them on their own.
+#define CONTAINER_MINIMAL_CAPACITY ((int64_t)16)
+
+// NOTE: the stack keeps its first elements inline, so the short lived stacks never allocate.
+#define STACK_INLINE_CAPACITY ((int64_t)16)
+
 struct Stack
 {
-	struct SNode* top;
+	void** elements; // null, while the inline elements suffice
 	int64_t count;
+	int64_t capacity;
+	struct Arena* arena; // null for heap allocated elements
+	void* inlineElements[STACK_INLINE_CAPACITY];
 };
 
 struct Stack Stack_create(
-	void);
+	struct Arena* const arena);
 
 void Stack_destroy(
 	struct Stack* const stack);
@@ -50,21 +89,18 @@ void* Stack_peek(
 	struct Stack* const stack,
 	int64_t offset);
 
-struct QNode
-{
-	void* data;
-	struct QNode* next;
-};
-
+// NOTE: ring buffer, the front element is at the `front` index of the `elements`.
 struct Queue
 {
-	struct QNode* front;
-	struct QNode* back;
+	void** elements;
+	int64_t front;
 	int64_t count;
+	int64_t capacity;
+	struct Arena* arena; // null for heap allocated elements
 };
 
 struct Queue Queue_create(
-	void);
+	struct Arena* const arena);
 
 void Queue_destroy(
 	struct Queue* const queue);
@@ -79,21 +115,16 @@ void* Queue_dequeue(
 void* Queue_peek(
 	struct Queue* const queue);
 
-struct LNode
-{
-	void* data;
-	struct LNode* next;
-};
-
 struct List
 {
-	struct LNode* front;
-	struct LNode* back;
+	void** elements; // in the push order
 	int64_t count;
+	int64_t capacity;
+	struct Arena* arena; // null for heap allocated elements
 };
 
 struct List List_create(
-	void);
+	struct Arena* const arena);
 
 void List_destroy(
 	struct List* const list);
@@ -102,6 +133,10 @@ void List_push(
 	struct List* const list,
 	void* data);
 
+void* List_at(
+	const struct List* const list,
+	const int64_t index);
+
 signed char List_exists(
 	struct List* const list,
 	void* data);
@@ -121,128 +156,371 @@ signed char Location_isInvalid(
 const char* Location_stringify(
 	const struct Location location);
 
-struct Token
+struct Source
 {
-	int64_t id;
+	const char* file;
+	char* buffer;
+	int64_t length;
+	signed char isMapped;
+
+	// NOTE: mapping of the cached token stream of the source (see `Cache_load`), the tokens
+	//       columns point into it, so it is unmapped together with the source.
+	void* cache;
+	int64_t cacheLength;
+
+	// NOTE: offsets of the lines' beginnings, built by the first `Source_locate` (or by the
+	//       `Source_indexLines`), so the lines and columns are only ever computed for the
+	//       diagnostics.
+	int64_t* lineStarts;
+	int64_t linesCount;
+};
 
-	enum
-	{
-		TOKEN_INVALID = 0,
-		TOKEN_IDENTIFIER,
-
-		TOKEN_FIRST_KEYWORD,
-		TOKEN_KEYWORD_MAIN = TOKEN_FIRST_KEYWORD,
-		TOKEN_KEYWORD_I64,
-		TOKEN_KEYWORD_P64,
-		TOKEN_KEYWORD_IF,
-		TOKEN_KEYWORD_ELSE,
-		TOKEN_KEYWORD_WHILE,
-		TOKEN_KEYWORD_PROCEDURE,
-		TOKEN_KEYWORD_REQUIRE,
-		TOKEN_KEYWORD_RETURN,
-		TOKEN_KEYWORD_DO,
-		TOKEN_KEYWORD_END,
-		TOKEN_LAST_KEYWORD = TOKEN_KEYWORD_END,
-
-		TOKEN_FIRST_INTRINSIC,
-		TOKEN_INTRINSIC_ADD = TOKEN_FIRST_INTRINSIC,
-		TOKEN_INTRINSIC_SUBTRACT,
-		TOKEN_INTRINSIC_MULTIPLY,
-		TOKEN_INTRINSIC_DIVIDE,
-		TOKEN_INTRINSIC_MODULUS,
-		TOKEN_INTRINSIC_EQUAL,
-		TOKEN_INTRINSIC_NEQUAL,
-		TOKEN_INTRINSIC_GREATER,
-		TOKEN_INTRINSIC_LESS,
-		TOKEN_INTRINSIC_BAND,
-		TOKEN_INTRINSIC_BOR,
-		TOKEN_INTRINSIC_BNOT,
-		TOKEN_INTRINSIC_SHIFTL,
-		TOKEN_INTRINSIC_SHIFTR,
-		TOKEN_INTRINSIC_SYSCALL0,
-		TOKEN_INTRINSIC_SYSCALL1,
-		TOKEN_INTRINSIC_SYSCALL2,
-		TOKEN_INTRINSIC_SYSCALL3,
-		TOKEN_INTRINSIC_SYSCALL4,
-		TOKEN_INTRINSIC_SYSCALL5,
-		TOKEN_INTRINSIC_SYSCALL6,
-		TOKEN_INTRINSIC_CLONE,
-		TOKEN_INTRINSIC_DROP,
-		TOKEN_INTRINSIC_OVER,
+struct Source Source_create(
+	const char* file);
+
+// NOTE: resolves the offset into the buffer of the loaded source into the file, the line, and
+//       the column (both starting at 1).
+struct Location Source_locate(
+	struct Source* const source,
+	const int64_t offset);
+
+// NOTE: builds the lines index of the loaded source, unless it is built already. It must be
+//       called before the diagnostics are logged from multiple threads.
+void Source_indexLines(
+	struct Source* const source);
+
+void Source_destroy(
+	struct Source* const source);
+
+enum TokenKind
+{
+	TOKEN_INVALID = 0,
+	TOKEN_IDENTIFIER,
+
+	TOKEN_FIRST_KEYWORD,
+	TOKEN_KEYWORD_MAIN = TOKEN_FIRST_KEYWORD,
+	TOKEN_KEYWORD_I64,
+	TOKEN_KEYWORD_P64,
+	TOKEN_KEYWORD_IF,
+	TOKEN_KEYWORD_ELSE,
+	TOKEN_KEYWORD_WHILE,
+	TOKEN_KEYWORD_PROCEDURE,
+	TOKEN_KEYWORD_REQUIRE,
+	TOKEN_KEYWORD_RETURN,
+	TOKEN_KEYWORD_DO,
+	TOKEN_KEYWORD_END,
+	TOKEN_LAST_KEYWORD = TOKEN_KEYWORD_END,
+
+	TOKEN_FIRST_INTRINSIC,
+	TOKEN_INTRINSIC_ADD = TOKEN_FIRST_INTRINSIC,
+	TOKEN_INTRINSIC_SUBTRACT,
+	TOKEN_INTRINSIC_MULTIPLY,
+	TOKEN_INTRINSIC_DIVIDE,
+	TOKEN_INTRINSIC_MODULUS,
+	TOKEN_INTRINSIC_EQUAL,
+	TOKEN_INTRINSIC_NEQUAL,
+	TOKEN_INTRINSIC_GREATER,
+	TOKEN_INTRINSIC_LESS,
+	TOKEN_INTRINSIC_BAND,
+	TOKEN_INTRINSIC_BOR,
+	TOKEN_INTRINSIC_BNOT,
+	TOKEN_INTRINSIC_SHIFTL,
+	TOKEN_INTRINSIC_SHIFTR,
+	TOKEN_INTRINSIC_SYSCALL0,
+	TOKEN_INTRINSIC_SYSCALL1,
+	TOKEN_INTRINSIC_SYSCALL2,
+	TOKEN_INTRINSIC_SYSCALL3,
+	TOKEN_INTRINSIC_SYSCALL4,
+	TOKEN_INTRINSIC_SYSCALL5,
+	TOKEN_INTRINSIC_SYSCALL6,
+	TOKEN_INTRINSIC_CLONE,
+	TOKEN_INTRINSIC_DROP,
+	TOKEN_INTRINSIC_OVER,
 #if HIVEC_DEBUG
 // TODO: remove all development keywords:
-		TOKEN_INTRINSIC_PRINTN,
+	TOKEN_INTRINSIC_PRINTN,
 #endif
-		TOKEN_INTRINSIC_SWAP, // NOTE: might add more
-		TOKEN_LAST_INTRINSIC = TOKEN_INTRINSIC_SWAP,
+	TOKEN_INTRINSIC_SWAP, // NOTE: might add more
+	TOKEN_LAST_INTRINSIC = TOKEN_INTRINSIC_SWAP,
 
-		TOKEN_FIRST_LITERAL,
-		TOKEN_LITERAL_I64 = TOKEN_FIRST_LITERAL,
-		TOKEN_LITERAL_STRING, // NOTE: might add char literal
-		TOKEN_LAST_LITERAL = TOKEN_LITERAL_STRING,
+	TOKEN_FIRST_LITERAL,
+	TOKEN_LITERAL_I64 = TOKEN_FIRST_LITERAL,
+	TOKEN_LITERAL_STRING, // NOTE: might add char literal
+	TOKEN_LAST_LITERAL = TOKEN_LITERAL_STRING,
 
-		TOKEN_EOF,
+	TOKEN_EOF,
 
-		TOKENS_COUNT,
-	} kind;
+	TOKENS_COUNT,
+};
 
-	union
+union TokenValue
+{
+	int64_t i64;
+	struct
 	{
-		int64_t i64;
-		struct
-		{
-			unsigned char* bytes;
-			int64_t length;
-		} string;
-	} value;
+		const unsigned char* bytes; // view into the source, or decoded into the arena
+		int64_t length;
+	} string;
+};
+
+// NOTE: a single token, as the lexer produces it, before it is pushed into the `struct Tokens`.
+struct Token
+{
+	enum TokenKind kind;
+	union TokenValue value;
 
 	struct
 	{
-		char* buffer;
+		const char* buffer; // view into the buffer of the token's `struct Source`
 		int64_t length;
 	} source;
+};
 
-	struct Location location;
-	struct Token* nextRef;
-	struct Token* previousRef;
-	struct Hash256 hash;
+#define INVALID_TOKEN ((int64_t)-1)
+#define INVALID_SYMBOL ((int64_t)-1)
+
+// NOTE: interned spellings of the identifiers and string literals of one compilation unit.
+//       Equal spellings get the same dense symbol id, so the passes compare ids instead of
+//       the text, and can index arrays with them.
+struct Symbols
+{
+	struct Arena* arena;
+	int64_t count;
+	int64_t capacity;
+	const char** texts; // into the buffer of the source
+	int64_t* lengths;
+	uint64_t* hashes;
+
+	// NOTE: open addressing table of the symbol ids, its capacity is always a power of 2.
+	int64_t* slots;
+	int64_t slotsCapacity;
+};
+
+struct Symbols Symbols_create(
+	struct Arena* const arena);
+
+int64_t Symbols_intern(
+	struct Symbols* const symbols,
+	const char* const text,
+	const int64_t length);
+
+// NOTE: the token stream of one compilation unit. Every token is a token id (its index), and
+//       its fields are stored in parallel columns, so passes, that only look at kinds, walk
+//       one dense array.
+struct Tokens
+{
+	struct Arena* arena;
+	struct Source* source;
+	int64_t count;
+	int64_t capacity;
+
+	// NOTE: the offset is the token's only location, its line and column are resolved by
+	//       the `Tokens_location` from the source, when a diagnostic needs them.
+	unsigned char* kinds;
+	union TokenValue* values;
+	uint32_t* offsets; // into the buffer of the `source`
+	int64_t* lengths;
+
+	// NOTE: symbol ids of the identifiers, string literals, and `main` keywords, and the
+	//       `INVALID_SYMBOL` for all other tokens.
+	int64_t* symbolIds;
+	struct Symbols symbols;
+
+	// NOTE: the cold columns, linking the blocks, used only by the parser to lower the jumps.
+	//       The translator labels instructions with their tokens' offsets, so no per-token label
+	//       is stored.
+	int64_t* nextRefs;
+	int64_t* previousRefs;
 };
 
-void Token_destroy(
-	struct Token* const token);
+// NOTE: the offsets are 32-bit, so the source must not be longer than this.
+#define TOKENS_MAXIMAL_SOURCE_LENGTH ((int64_t)UINT32_MAX)
 
-const char* Token_stringify(
+struct Tokens Tokens_create(
+	struct Arena* const arena,
+	struct Source* const source);
+
+int64_t Tokens_push(
+	struct Tokens* const tokens,
 	const struct Token* const token);
 
+// NOTE: appends all tokens of the `other` stream (of the same source), renumbering their ids.
+void Tokens_append(
+	struct Tokens* const tokens,
+	const struct Tokens* const other);
+
+// NOTE: drops the tokens from the provided count on, keeping their columns' capacity and the
+//       interned symbols, so a stream can be reused as a window of the source.
+void Tokens_truncate(
+	struct Tokens* const tokens,
+	const int64_t count);
+
+const char* Tokens_source(
+	const struct Tokens* const tokens,
+	const int64_t token);
+
+struct Location Tokens_location(
+	const struct Tokens* const tokens,
+	const int64_t token);
+
+const char* Tokens_stringify(
+	const struct Tokens* const tokens,
+	const int64_t token);
+
+// NOTE: range of token ids, from the `begin` up to, but excluding, the `end`.
+struct TokensRange
+{
+	int64_t begin;
+	int64_t end;
+};
+
+// NOTE: opcodes of the instructions, that the procedures' bodies are lowered to. The intrinsic
+//       opcodes are listed in the same order as the intrinsic token kinds.
+enum Opcode
+{
+	OPCODE_PUSH_I64 = 0, // operand: the value
+	OPCODE_PUSH_STRING, // operand: the pool index of the string literal
+	OPCODE_CALL, // operand: the index of the called procedure (see `Parser_resolveCalls`)
+	OPCODE_JUMP,
+	OPCODE_JUMP_UNLESS, // pops the condition and jumps, if it is 0
+	OPCODE_RETURN, // always the last instruction of a body
+
+	OPCODE_FIRST_INTRINSIC,
+	OPCODE_ADD = OPCODE_FIRST_INTRINSIC,
+	OPCODE_SUBTRACT,
+	OPCODE_MULTIPLY,
+	OPCODE_DIVIDE,
+	OPCODE_MODULUS,
+	OPCODE_EQUAL,
+	OPCODE_NEQUAL,
+	OPCODE_GREATER,
+	OPCODE_LESS,
+	OPCODE_BAND,
+	OPCODE_BOR,
+	OPCODE_BNOT,
+	OPCODE_SHIFTL,
+	OPCODE_SHIFTR,
+	OPCODE_SYSCALL0,
+	OPCODE_SYSCALL1,
+	OPCODE_SYSCALL2,
+	OPCODE_SYSCALL3,
+	OPCODE_SYSCALL4,
+	OPCODE_SYSCALL5,
+	OPCODE_SYSCALL6,
+	OPCODE_CLONE,
+	OPCODE_DROP,
+	OPCODE_OVER,
+#if HIVEC_DEBUG
+// TODO: remove all development keywords:
+	OPCODE_PRINTN,
+#endif
+	OPCODE_SWAP,
+	OPCODE_LAST_INTRINSIC = OPCODE_SWAP,
+
+	OPCODES_COUNT,
+};
+
+#define INVALID_INSTRUCTION ((uint32_t)UINT32_MAX)
+
+// NOTE: one instruction of a lowered procedure's body. The target is the index of the jumped to
+//       instruction in the same body, and the token is the instruction's source location id,
+//       the diagnostics and the labels are derived from. Token ids fit into 32 bits, since the
+//       tokens are never more than the bytes of the source. The depth is the count of values on
+//       the data stack right before the instruction, which the validator computes along every
+//       path of the control-flow, so the translator can map the stack values to fixed slots. It
+//       takes the padding after the opcode, so the instructions stay 24 bytes.
+struct Instruction
+{
+	int64_t operand;
+	uint32_t target;
+	uint32_t token;
+	unsigned char opcode;
+	uint32_t depth;
+};
+
+#define INVALID_PROCEDURE ((int64_t)-1)
+
 struct Procedure
 {
-	struct Token* name;
-	struct List requiredTypes;
-	struct List returnedTypes;
-	struct List body; // excluding `do` and `end`
+	int64_t name;
+	int64_t index; // in the definition order, names the procedure's label
+	struct TokensRange requiredTypes;
+	struct TokensRange returnedTypes;
+	struct TokensRange body; // excluding `do` and `end`
 	signed char isMain;
+
+	// NOTE: the body, lowered by the parser into one contiguous array, that the validator and
+	//       the translator walk instead of the tokens.
+	struct Instruction* instructions;
+	int64_t instructionsCount;
+	int64_t stackDepth; // the deepest the data stack gets, computed by the validator
 };
 
 struct Procedure* Procedure_create(
-	void);
-
-void Procedure_destroy(
-	struct Procedure* const procedure);
+	struct Arena* const arena);
 
 void Procedure_print(
+	const struct Tokens* const tokens,
 	const struct Procedure* const procedure);
 
+// NOTE: the pool keeps its own copy of the decoded bytes, so a string literal outlives the
+//       tokens, it was pooled from (see `Tokens_truncate`).
+struct StringLiteral
+{
+	const unsigned char* bytes;
+	int64_t length;
+	int64_t index; // in the pool, names the string literal's data
+	uint64_t hash; // of the decoded bytes
+};
+
 struct Globals
 {
-	struct List procedures;
-	struct List stringLiterals;
+	struct Arena* arena;
+	const struct Tokens* tokens;
+	struct List procedures; // in the definition order
+	struct List stringLiterals; // in the pool order
+
+	// NOTE: open addressing table of the procedures, keyed by the symbol ids of their names,
+	//       its capacity is always a power of 2.
+	struct Procedure** procedureSlots;
+	int64_t procedureSlotsCapacity;
+	struct Procedure* main;
+
+	// NOTE: open addressing table of the string literals pool, keyed by their decoded bytes,
+	//       so differently spelled, but equal string literals share the data. The pool index
+	//       of every string literal symbol is kept aside, so the equally spelled string
+	//       literals are pooled without hashing.
+	struct StringLiteral** stringSlots;
+	int64_t stringSlotsCapacity;
+	int64_t* stringIndices;
+	int64_t stringIndicesCapacity;
 };
 
 struct Globals Globals_create(
-	void);
+	struct Arena* const arena);
+
+// NOTE: defines the procedure in the globals and assigns its index, unless a procedure of the
+//       same name is already defined, which is returned instead (and the provided one is not
+//       defined).
+struct Procedure* Globals_define(
+	struct Globals* const globals,
+	struct Procedure* const procedure);
 
-void Globals_destroy(
-	struct Globals* const globals);
+// NOTE: returns the procedure, whose name has the provided symbol id, or null.
+struct Procedure* Globals_find(
+	const struct Globals* const globals,
+	const int64_t symbolId);
+
+// NOTE: pools the decoded bytes of the provided string literal token and returns the index
+//       of its pool entry.
+int64_t Globals_poolString(
+	struct Globals* const globals,
+	const int64_t token);
+
+// NOTE: returns the pool index of the provided, already pooled, string literal token.
+int64_t Globals_stringIndex(
+	const struct Globals* const globals,
+	const int64_t token);
 
 enum Severity
 {
@@ -21,8 +21,18 @@
  * @{
  */
 
+// NOTE: big modules are validated on up to the threads count of threads, with the same
+//       diagnostics, as if they were validated on one thread.
 signed char Validator_validateTokens(
 	struct Globals* const globals,
+	const int64_t threadsCount,
+	struct Queue* const logs);
+
+// NOTE: validates just the provided procedure, so the procedures can be validated one by one,
+//       as soon as their bodies are parsed (see `Parser_parseProcedureTokens`).
+signed char Validator_validateProcedureTokens(
+	const struct Globals* const globals,
+	struct Procedure* const procedure,
 	struct Queue* const logs);
 
 /**
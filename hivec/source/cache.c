@@ -0,0 +1,658 @@
+/**
+ * @file cache.c
+ *
+ * @copyright This file is a part of the project hivelang and is distributed under MIT license that
+ * should have been included with the project. If not, see https://choosealicense.com/licenses/mit/
+ *
+ * @author joba14
+ *
+ * @date 2022-09-26
+ */
+
+#include <cache.h>
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+
+#ifdef WIN32
+// TODO: add equivalent of sys/mman.h, sys/stat.h, fcntl.h, and unistd.h!
+#	error "TODO: need to add equivalent of sys/mman.h, sys/stat.h, fcntl.h, and unistd.h!"
+#else
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <fcntl.h>
+#	include <unistd.h>
+#endif
+
+/**
+ * @addtogroup cache
+ *
+ * @{
+ */
+
+// NOTES:
+//     1. A cache file is the header followed by the sections: the raw `struct Tokens` columns,
+//        the raw `struct Symbols` columns, and the decoded bytes of the string literals. Every
+//        section is aligned, so once the file is mapped the columns are used in place.
+//     2. Pointers can not be stored, so the string literals' values hold offsets into the bytes
+//        section and the symbols' texts hold offsets into the source. They are the only fields,
+//        that are rebased after mapping.
+#define CACHE_MAGIC "HIVETOKS"
+#define CACHE_ALIGNMENT ((int64_t)16)
+#define CACHE_PATH_CAPACITY ((int64_t)4096)
+#define CACHE_HEADER_SIZE ((int64_t)((sizeof(struct CacheHeader) + CACHE_ALIGNMENT - 1) / CACHE_ALIGNMENT * CACHE_ALIGNMENT))
+
+enum CacheSection
+{
+	CACHE_SECTION_KINDS = 0,
+	CACHE_SECTION_VALUES,
+	CACHE_SECTION_OFFSETS,
+	CACHE_SECTION_LENGTHS,
+	CACHE_SECTION_SYMBOL_IDS,
+	CACHE_SECTION_NEXT_REFS,
+	CACHE_SECTION_PREVIOUS_REFS,
+	CACHE_SECTION_SYMBOL_TEXTS,
+	CACHE_SECTION_SYMBOL_LENGTHS,
+	CACHE_SECTION_SYMBOL_HASHES,
+	CACHE_SECTION_SYMBOL_SLOTS,
+	CACHE_SECTION_BYTES,
+	CACHE_SECTIONS_COUNT
+};
+
+struct CacheHeader
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t valueSize;
+	uint32_t kindsCount; // differs between the debug and release configurations
+	uint64_t hash;
+	int64_t sourceLength;
+	int64_t tokensCount;
+	int64_t symbolsCount;
+	int64_t slotsCapacity;
+	int64_t bytesLength;
+	int64_t sections[CACHE_SECTIONS_COUNT]; // offsets from the beginning of the file
+};
+
+static_assert(sizeof(const char*) == sizeof(int64_t), "Symbols' texts are stored as 64-bit offsets!");
+
+static uint64_t Cache_hashBytes(
+	const unsigned char* bytes,
+	const int64_t length);
+
+static signed char Cache_formatPath(
+	char* const path,
+	const char* const directory,
+	const struct CacheKey* const key);
+
+static signed char Cache_checkPayload(
+	const struct CacheHeader* const header,
+	const unsigned char* const mapping);
+
+static void Cache_sizeSections(
+	const struct CacheHeader* const header,
+	int64_t sizes[CACHE_SECTIONS_COUNT]);
+
+static signed char Cache_writeSection(
+	FILE* const file,
+	const void* const data,
+	const int64_t size);
+
+struct CacheKey Cache_hash(
+	const struct Source* const source)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The source, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(source != NULL);
+
+	struct CacheKey key = {0};
+	key.hash = Cache_hashBytes((const unsigned char*)source->buffer, source->length);
+	key.length = source->length;
+	return key;
+}
+
+signed char Cache_load(
+	const char* const directory,
+	const struct CacheKey* const key,
+	struct Source* const source,
+	struct Tokens* const tokens)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The directory and the key, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(directory != NULL && key != NULL);
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The source and the tokens, provided to this function, must never ever be null,
+	//        and the tokens must be of the source.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(source != NULL && tokens != NULL && tokens->source == source);
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The cache is loaded instead of lexing, so the tokens must be empty.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(tokens->count == 0 && source->cache == NULL);
+
+	char path[CACHE_PATH_CAPACITY] = {0};
+
+	if (!Cache_formatPath(path, directory, key))
+	{
+		return 0;
+	}
+
+	signed int descriptor = open(path, O_RDONLY);
+
+	if (descriptor < 0)
+	{
+		return 0;
+	}
+
+	struct stat status = {0};
+
+	if (fstat(descriptor, &status) != 0 || !S_ISREG(status.st_mode) || status.st_size < (off_t)sizeof(struct CacheHeader))
+	{
+		close(descriptor);
+		return 0;
+	}
+
+	// NOTE: mapping privately and writable, so the few rebased fields are copied on write and
+	//       the cache file itself is never modified.
+	const int64_t length = (int64_t)status.st_size;
+	unsigned char* mapping = (unsigned char*)mmap(NULL, (size_t)length, PROT_READ | PROT_WRITE, MAP_PRIVATE, descriptor, 0);
+	close(descriptor);
+
+	if (mapping == MAP_FAILED)
+	{
+		return 0;
+	}
+
+	const struct CacheHeader* header = (const struct CacheHeader*)mapping;
+	signed char valid = memcmp(header->magic, CACHE_MAGIC, sizeof(header->magic)) == 0
+		&& header->version == CACHE_VERSION
+		&& header->valueSize == (uint32_t)sizeof(union TokenValue)
+		&& header->kindsCount == (uint32_t)TOKENS_COUNT
+		&& header->hash == key->hash
+		&& header->sourceLength == key->length
+		&& header->sourceLength == source->length
+		&& header->tokensCount >= 0 && header->tokensCount <= length
+		&& header->symbolsCount >= 0 && header->symbolsCount <= length
+		&& header->slotsCapacity >= 0 && header->slotsCapacity <= length
+		&& (header->slotsCapacity & (header->slotsCapacity - 1)) == 0
+		&& header->bytesLength >= 0 && header->bytesLength <= length;
+
+	int64_t sizes[CACHE_SECTIONS_COUNT] = {0};
+
+	if (valid)
+	{
+		Cache_sizeSections(header, sizes);
+	}
+
+	for (int64_t section = 0; valid && section < CACHE_SECTIONS_COUNT; ++section)
+	{
+		valid = header->sections[section] >= CACHE_HEADER_SIZE
+			&& header->sections[section] % CACHE_ALIGNMENT == 0
+			&& sizes[section] <= length - header->sections[section];
+	}
+
+	// NOTE: the payload is checked before anything is pointed into it, so a damaged cache is
+	//       treated as a missing one and the source is lexed instead.
+	if (!valid || !Cache_checkPayload(header, mapping))
+	{
+		munmap(mapping, (size_t)length);
+		return 0;
+	}
+
+	tokens->kinds = (unsigned char*)(mapping + header->sections[CACHE_SECTION_KINDS]);
+	tokens->values = (union TokenValue*)(mapping + header->sections[CACHE_SECTION_VALUES]);
+	tokens->offsets = (uint32_t*)(mapping + header->sections[CACHE_SECTION_OFFSETS]);
+	tokens->lengths = (int64_t*)(mapping + header->sections[CACHE_SECTION_LENGTHS]);
+	tokens->symbolIds = (int64_t*)(mapping + header->sections[CACHE_SECTION_SYMBOL_IDS]);
+	tokens->nextRefs = (int64_t*)(mapping + header->sections[CACHE_SECTION_NEXT_REFS]);
+	tokens->previousRefs = (int64_t*)(mapping + header->sections[CACHE_SECTION_PREVIOUS_REFS]);
+	tokens->count = header->tokensCount;
+	tokens->capacity = header->tokensCount;
+
+	struct Symbols* symbols = &tokens->symbols;
+	symbols->texts = (const char**)(mapping + header->sections[CACHE_SECTION_SYMBOL_TEXTS]);
+	symbols->lengths = (int64_t*)(mapping + header->sections[CACHE_SECTION_SYMBOL_LENGTHS]);
+	symbols->hashes = (uint64_t*)(mapping + header->sections[CACHE_SECTION_SYMBOL_HASHES]);
+	symbols->slots = (int64_t*)(mapping + header->sections[CACHE_SECTION_SYMBOL_SLOTS]);
+	symbols->count = header->symbolsCount;
+	symbols->capacity = header->symbolsCount;
+	symbols->slotsCapacity = header->slotsCapacity;
+
+	// Rebasing the offsets, that were stored in place of the pointers
+	const unsigned char* bytes = mapping + header->sections[CACHE_SECTION_BYTES];
+
+	for (int64_t token = 0; token < tokens->count; ++token)
+	{
+		if (tokens->kinds[token] == TOKEN_LITERAL_STRING)
+		{
+			tokens->values[token].string.bytes = bytes + (uintptr_t)tokens->values[token].string.bytes;
+		}
+	}
+
+	for (int64_t symbol = 0; symbol < symbols->count; ++symbol)
+	{
+		symbols->texts[symbol] = source->buffer + (uintptr_t)symbols->texts[symbol];
+	}
+
+	source->cache = mapping;
+	source->cacheLength = length;
+	return 1;
+}
+
+signed char Cache_store(
+	const char* const directory,
+	const struct CacheKey* const key,
+	const struct Source* const source,
+	const struct Tokens* const tokens)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The directory and the key, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(directory != NULL && key != NULL);
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The source and the tokens, provided to this function, must never ever be null,
+	//        and the tokens must be of the source.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(source != NULL && tokens != NULL && tokens->source == source);
+
+	char path[CACHE_PATH_CAPACITY] = {0};
+	char temporaryPath[CACHE_PATH_CAPACITY] = {0};
+
+	if (!Cache_formatPath(path, directory, key)
+	 || snprintf(temporaryPath, sizeof(temporaryPath), "%s.%ld", path, (int64_t)getpid()) >= (signed int)sizeof(temporaryPath))
+	{
+		return 0;
+	}
+
+	if (mkdir(directory, 0755) != 0 && errno != EEXIST)
+	{
+		return 0;
+	}
+
+	// NOTE: the string literals' bytes are gathered into one section and their values are
+	//       replaced with the offsets into it.
+	union TokenValue* values = (union TokenValue*)malloc((size_t)(tokens->count > 0 ? tokens->count : 1) * sizeof(union TokenValue));
+	int64_t bytesLength = 0;
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The memory allocation errors can happen anytime, no matter build
+	//        configuration being debug or release. However, since the compiler
+	//        cannot prevent such bugs, I will leave it as assert. Worst case
+	//        scenario - the compiler crashes, and user re-runs it.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(values != NULL);
+
+	for (int64_t token = 0; token < tokens->count; ++token)
+	{
+		values[token] = tokens->values[token];
+
+		if (tokens->kinds[token] == TOKEN_LITERAL_STRING)
+		{
+			values[token].string.bytes = (const unsigned char*)(uintptr_t)bytesLength;
+			bytesLength += tokens->values[token].string.length;
+		}
+	}
+
+	const char** texts = (const char**)malloc((size_t)(tokens->symbols.count > 0 ? tokens->symbols.count : 1) * sizeof(const char*));
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The memory allocation errors can happen anytime, no matter build
+	//        configuration being debug or release. However, since the compiler
+	//        cannot prevent such bugs, I will leave it as assert. Worst case
+	//        scenario - the compiler crashes, and user re-runs it.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(texts != NULL);
+
+	for (int64_t symbol = 0; symbol < tokens->symbols.count; ++symbol)
+	{
+		texts[symbol] = (const char*)(uintptr_t)(tokens->symbols.texts[symbol] - source->buffer);
+	}
+
+	struct CacheHeader header = {0};
+	memcpy(header.magic, CACHE_MAGIC, sizeof(header.magic));
+	header.version = CACHE_VERSION;
+	header.valueSize = (uint32_t)sizeof(union TokenValue);
+	header.kindsCount = (uint32_t)TOKENS_COUNT;
+	header.hash = key->hash;
+	header.sourceLength = key->length;
+	header.tokensCount = tokens->count;
+	header.symbolsCount = tokens->symbols.count;
+	header.slotsCapacity = tokens->symbols.slotsCapacity;
+	header.bytesLength = bytesLength;
+
+	int64_t sizes[CACHE_SECTIONS_COUNT] = {0};
+	Cache_sizeSections(&header, sizes);
+
+	for (int64_t section = 0, offset = CACHE_HEADER_SIZE; section < CACHE_SECTIONS_COUNT; ++section)
+	{
+		header.sections[section] = offset;
+		offset += (sizes[section] + CACHE_ALIGNMENT - 1) / CACHE_ALIGNMENT * CACHE_ALIGNMENT;
+	}
+
+	const void* datas[CACHE_SECTIONS_COUNT] =
+	{
+		[CACHE_SECTION_KINDS] = tokens->kinds,
+		[CACHE_SECTION_VALUES] = values,
+		[CACHE_SECTION_OFFSETS] = tokens->offsets,
+		[CACHE_SECTION_LENGTHS] = tokens->lengths,
+		[CACHE_SECTION_SYMBOL_IDS] = tokens->symbolIds,
+		[CACHE_SECTION_NEXT_REFS] = tokens->nextRefs,
+		[CACHE_SECTION_PREVIOUS_REFS] = tokens->previousRefs,
+		[CACHE_SECTION_SYMBOL_TEXTS] = texts,
+		[CACHE_SECTION_SYMBOL_LENGTHS] = tokens->symbols.lengths,
+		[CACHE_SECTION_SYMBOL_HASHES] = tokens->symbols.hashes,
+		[CACHE_SECTION_SYMBOL_SLOTS] = tokens->symbols.slots,
+		[CACHE_SECTION_BYTES] = NULL
+	};
+
+	// NOTE: writing into a temporary file and renaming it, so concurrent compilers never map a
+	//       partially written cache.
+	FILE* file = fopen(temporaryPath, "wb");
+	signed char written = file != NULL && Cache_writeSection(file, &header, (int64_t)sizeof(header));
+
+	for (int64_t section = 0; written && section < CACHE_SECTION_BYTES; ++section)
+	{
+		written = Cache_writeSection(file, datas[section], sizes[section]);
+	}
+
+	for (int64_t token = 0; written && token < tokens->count; ++token)
+	{
+		if (tokens->kinds[token] == TOKEN_LITERAL_STRING)
+		{
+			const int64_t length = tokens->values[token].string.length;
+			written = length <= 0 || fwrite(tokens->values[token].string.bytes, (size_t)length, 1, file) == 1;
+		}
+	}
+
+	free(values);
+	free(texts);
+
+	if (file != NULL && fclose(file) != 0)
+	{
+		written = 0;
+	}
+
+	if (!written || rename(temporaryPath, path) != 0)
+	{
+		remove(temporaryPath);
+		return 0;
+	}
+
+	return 1;
+}
+
+static uint64_t Cache_hashBytes(
+	const unsigned char* bytes,
+	const int64_t length)
+{
+	// NOTE: the XXH64 hash, it consumes 32 bytes per step in four independent lanes, so hashing
+	//       the source costs a small fraction of lexing it.
+	#define prime1 ((uint64_t)11400714785074694791ULL)
+	#define prime2 ((uint64_t)14029467366897019727ULL)
+	#define prime3 ((uint64_t)1609587929392839161ULL)
+	#define prime4 ((uint64_t)9650029242287828579ULL)
+	#define prime5 ((uint64_t)2870177450012600261ULL)
+	#define rotate(value, bits) (((value) << (bits)) | ((value) >> (64 - (bits))))
+	#define mix(accumulator, input) (rotate((accumulator) + (input) * prime2, 31) * prime1)
+
+	const unsigned char* end = bytes + length;
+	uint64_t hash = 0;
+
+	if (length >= 32)
+	{
+		uint64_t lanes[4] = { prime1 + prime2, prime2, 0, 0 - prime1 };
+
+		for (; end - bytes >= 32; bytes += 32)
+		{
+			for (int64_t lane = 0; lane < 4; ++lane)
+			{
+				uint64_t input = 0;
+				memcpy(&input, bytes + lane * 8, sizeof(input));
+				lanes[lane] = mix(lanes[lane], input);
+			}
+		}
+
+		hash = rotate(lanes[0], 1) + rotate(lanes[1], 7) + rotate(lanes[2], 12) + rotate(lanes[3], 18);
+
+		for (int64_t lane = 0; lane < 4; ++lane)
+		{
+			hash = (hash ^ mix(0, lanes[lane])) * prime1 + prime4;
+		}
+	}
+	else
+	{
+		hash = prime5;
+	}
+
+	hash += (uint64_t)length;
+
+	for (; end - bytes >= 8; bytes += 8)
+	{
+		uint64_t input = 0;
+		memcpy(&input, bytes, sizeof(input));
+		hash ^= mix(0, input);
+		hash = rotate(hash, 27) * prime1 + prime4;
+	}
+
+	if (end - bytes >= 4)
+	{
+		uint32_t input = 0;
+		memcpy(&input, bytes, sizeof(input));
+		hash ^= (uint64_t)input * prime1;
+		hash = rotate(hash, 23) * prime2 + prime3;
+		bytes += 4;
+	}
+
+	for (; bytes < end; ++bytes)
+	{
+		hash ^= (uint64_t)*bytes * prime5;
+		hash = rotate(hash, 11) * prime1;
+	}
+
+	hash ^= hash >> 33;
+	hash *= prime2;
+	hash ^= hash >> 29;
+	hash *= prime3;
+	hash ^= hash >> 32;
+
+	#undef mix
+	#undef rotate
+	#undef prime5
+	#undef prime4
+	#undef prime3
+	#undef prime2
+	#undef prime1
+
+	return hash;
+}
+
+static signed char Cache_formatPath(
+	char* const path,
+	const char* const directory,
+	const struct CacheKey* const key)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The path, the directory, and the key, provided to this function, must never
+	//        ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(path != NULL && directory != NULL && key != NULL);
+
+	// NOTE: the file is named after the key, so equal sources share one cache no matter where
+	//       they are located.
+	const signed int length = snprintf(path, (size_t)CACHE_PATH_CAPACITY, "%s/%016lx%016lx.tokens", directory, key->hash, (uint64_t)key->length);
+	return length > 0 && length < (signed int)CACHE_PATH_CAPACITY;
+}
+
+static signed char Cache_checkPayload(
+	const struct CacheHeader* const header,
+	const unsigned char* const mapping)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The header and the mapping, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(header != NULL && mapping != NULL);
+
+	const unsigned char* kinds = mapping + header->sections[CACHE_SECTION_KINDS];
+	const union TokenValue* values = (const union TokenValue*)(mapping + header->sections[CACHE_SECTION_VALUES]);
+	const uint32_t* offsets = (const uint32_t*)(mapping + header->sections[CACHE_SECTION_OFFSETS]);
+	const int64_t* lengths = (const int64_t*)(mapping + header->sections[CACHE_SECTION_LENGTHS]);
+	const int64_t* symbolIds = (const int64_t*)(mapping + header->sections[CACHE_SECTION_SYMBOL_IDS]);
+	const int64_t* nextRefs = (const int64_t*)(mapping + header->sections[CACHE_SECTION_NEXT_REFS]);
+	const int64_t* previousRefs = (const int64_t*)(mapping + header->sections[CACHE_SECTION_PREVIOUS_REFS]);
+	const int64_t* texts = (const int64_t*)(mapping + header->sections[CACHE_SECTION_SYMBOL_TEXTS]);
+	const int64_t* symbolLengths = (const int64_t*)(mapping + header->sections[CACHE_SECTION_SYMBOL_LENGTHS]);
+	const int64_t* slots = (const int64_t*)(mapping + header->sections[CACHE_SECTION_SYMBOL_SLOTS]);
+
+	const int64_t sourceLength = header->sourceLength;
+	const int64_t tokensCount = header->tokensCount;
+	const int64_t symbolsCount = header->symbolsCount;
+
+	for (int64_t token = 0; token < tokensCount; ++token)
+	{
+		if (kinds[token] >= TOKENS_COUNT
+		 || lengths[token] < 0 || lengths[token] > sourceLength - (int64_t)offsets[token]
+		 || nextRefs[token] < INVALID_TOKEN || nextRefs[token] >= tokensCount
+		 || previousRefs[token] < INVALID_TOKEN || previousRefs[token] >= tokensCount)
+		{
+			return 0;
+		}
+
+		// NOTE: the passes index arrays with the symbol ids of the identifiers, the string
+		//       literals, and the `main` keywords, so they must be valid ones.
+		switch (kinds[token])
+		{
+			case TOKEN_IDENTIFIER:
+			case TOKEN_KEYWORD_MAIN:
+			case TOKEN_LITERAL_STRING:
+			{
+				if (symbolIds[token] < 0 || symbolIds[token] >= symbolsCount)
+				{
+					return 0;
+				}
+			} break;
+
+			default:
+			{
+				if (symbolIds[token] != INVALID_SYMBOL)
+				{
+					return 0;
+				}
+			} break;
+		}
+
+		if (kinds[token] == TOKEN_LITERAL_STRING)
+		{
+			const uint64_t offset = (uint64_t)(uintptr_t)values[token].string.bytes;
+			const int64_t length = values[token].string.length;
+
+			if (offset > (uint64_t)header->bytesLength || length < 0 || length > header->bytesLength - (int64_t)offset)
+			{
+				return 0;
+			}
+		}
+	}
+
+	for (int64_t symbol = 0; symbol < symbolsCount; ++symbol)
+	{
+		if (texts[symbol] < 0 || texts[symbol] > sourceLength
+		 || symbolLengths[symbol] < 0 || symbolLengths[symbol] > sourceLength - texts[symbol])
+		{
+			return 0;
+		}
+	}
+
+	// NOTE: the slots table must keep an empty slot, otherwise probing it would never end.
+	if (symbolsCount * 2 > header->slotsCapacity)
+	{
+		return 0;
+	}
+
+	for (int64_t slot = 0; slot < header->slotsCapacity; ++slot)
+	{
+		if (slots[slot] < INVALID_SYMBOL || slots[slot] >= symbolsCount)
+		{
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+static void Cache_sizeSections(
+	const struct CacheHeader* const header,
+	int64_t sizes[CACHE_SECTIONS_COUNT])
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The header and the sizes, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(header != NULL && sizes != NULL);
+
+	const int64_t tokensCount = header->tokensCount;
+	const int64_t symbolsCount = header->symbolsCount;
+
+	sizes[CACHE_SECTION_KINDS] = tokensCount * (int64_t)sizeof(unsigned char);
+	sizes[CACHE_SECTION_VALUES] = tokensCount * (int64_t)sizeof(union TokenValue);
+	sizes[CACHE_SECTION_OFFSETS] = tokensCount * (int64_t)sizeof(uint32_t);
+	sizes[CACHE_SECTION_LENGTHS] = tokensCount * (int64_t)sizeof(int64_t);
+	sizes[CACHE_SECTION_SYMBOL_IDS] = tokensCount * (int64_t)sizeof(int64_t);
+	sizes[CACHE_SECTION_NEXT_REFS] = tokensCount * (int64_t)sizeof(int64_t);
+	sizes[CACHE_SECTION_PREVIOUS_REFS] = tokensCount * (int64_t)sizeof(int64_t);
+	sizes[CACHE_SECTION_SYMBOL_TEXTS] = symbolsCount * (int64_t)sizeof(const char*);
+	sizes[CACHE_SECTION_SYMBOL_LENGTHS] = symbolsCount * (int64_t)sizeof(int64_t);
+	sizes[CACHE_SECTION_SYMBOL_HASHES] = symbolsCount * (int64_t)sizeof(uint64_t);
+	sizes[CACHE_SECTION_SYMBOL_SLOTS] = header->slotsCapacity * (int64_t)sizeof(int64_t);
+	sizes[CACHE_SECTION_BYTES] = header->bytesLength;
+}
+
+static signed char Cache_writeSection(
+	FILE* const file,
+	const void* const data,
+	const int64_t size)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The file, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(file != NULL);
+
+	static const unsigned char padding[CACHE_ALIGNMENT] = {0};
+	const int64_t paddingLength = (CACHE_ALIGNMENT - size % CACHE_ALIGNMENT) % CACHE_ALIGNMENT;
+
+	return (size <= 0 || fwrite(data, (size_t)size, 1, file) == 1)
+		&& (paddingLength <= 0 || fwrite(padding, (size_t)paddingLength, 1, file) == 1);
+}
+
+/**
+ * @}
+ */
@@ -11,12 +11,24 @@
  */
 
 #include <lexer.h>
+#include <scanner.h>
+#include <cache.h>
 
 #include <assert.h>
 #include <stdlib.h>
 #include <string.h>
-#include <stdio.h>
-#include <ctype.h>
+#include <errno.h>
+
+#ifdef WIN32
+// TODO: add equivalent of sys/mman.h!
+#	error "TODO: need to add equivalent of sys/mman.h!"
+#else
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <fcntl.h>
+#	include <unistd.h>
+#	include <pthread.h>
+#endif
 
 /**
  * @addtogroup lexer
@@ -24,88 +36,202 @@
  * @{
  */
 
-struct LexerContext
+// NOTE: a part of the source, made of whole lines, that is lexed by a worker into its own
+//       arena and tokens stream, which are then stitched into the file's ones.
+struct LexerChunk
 {
-	struct Location location;
 	const char* begin;
-	const char* current;
 	const char* end;
-	int64_t count;
+	struct Arena arena;
+	struct Tokens tokens;
+};
+
+// NOTE: reasons of the numerical literals to be invalid. It is stored in the value of the
+//       invalid token, so the validation of the tokens can report it.
+enum LexerLiteralError
+{
+	LEXER_LITERAL_ERROR_NONE = 0,
+	LEXER_LITERAL_ERROR_MALFORMED,
+	LEXER_LITERAL_ERROR_OVERFLOW
+};
+
+// NOTE: sources smaller than two chunks of this size are lexed on the calling thread, since
+//       spawning the workers would take longer than lexing them.
+#define LEXER_MINIMAL_CHUNK_LENGTH ((int64_t)(1024 * 1024))
+#define LEXER_MAXIMAL_CHUNKS_COUNT ((int64_t)64)
+
+// NOTE: this `wordsCount` define must be changed when modifying the `words` set!
+#if HIVEC_DEBUG
+// TODO: remove:
+	#define wordsCount ((int64_t)37)
+#else
+	#define wordsCount ((int64_t)36)
+#endif
+static const char* const words[TOKEN_LAST_INTRINSIC + 1] =
+{
+	[TOKEN_KEYWORD_MAIN] = "main",
+	[TOKEN_KEYWORD_I64] = "i64",
+	[TOKEN_KEYWORD_P64] = "p64",
+	[TOKEN_KEYWORD_IF] = "if",
+	[TOKEN_KEYWORD_ELSE] = "else",
+	[TOKEN_KEYWORD_WHILE] = "while",
+	[TOKEN_KEYWORD_PROCEDURE] = "procedure",
+	[TOKEN_KEYWORD_REQUIRE] = "require",
+	[TOKEN_KEYWORD_RETURN] = "return",
+	[TOKEN_KEYWORD_DO] = "do",
+	[TOKEN_KEYWORD_END] = "end",
+
+	[TOKEN_INTRINSIC_ADD] = "add",
+	[TOKEN_INTRINSIC_SUBTRACT] = "subtract",
+	[TOKEN_INTRINSIC_MULTIPLY] = "multiply",
+	[TOKEN_INTRINSIC_DIVIDE] = "divide",
+	[TOKEN_INTRINSIC_MODULUS] = "modulus",
+	[TOKEN_INTRINSIC_EQUAL] = "equal",
+	[TOKEN_INTRINSIC_NEQUAL] = "nequal",
+	[TOKEN_INTRINSIC_GREATER] = "greater",
+	[TOKEN_INTRINSIC_LESS] = "less",
+	[TOKEN_INTRINSIC_BAND] = "band",
+	[TOKEN_INTRINSIC_BOR] = "bor",
+	[TOKEN_INTRINSIC_BNOT] = "bnot",
+	[TOKEN_INTRINSIC_SHIFTL] = "shiftl",
+	[TOKEN_INTRINSIC_SHIFTR] = "shiftr",
+	[TOKEN_INTRINSIC_SYSCALL0] = "syscall0",
+	[TOKEN_INTRINSIC_SYSCALL1] = "syscall1",
+	[TOKEN_INTRINSIC_SYSCALL2] = "syscall2",
+	[TOKEN_INTRINSIC_SYSCALL3] = "syscall3",
+	[TOKEN_INTRINSIC_SYSCALL4] = "syscall4",
+	[TOKEN_INTRINSIC_SYSCALL5] = "syscall5",
+	[TOKEN_INTRINSIC_SYSCALL6] = "syscall6",
+	[TOKEN_INTRINSIC_CLONE] = "clone",
+	[TOKEN_INTRINSIC_DROP] = "drop",
+	[TOKEN_INTRINSIC_OVER] = "over",
+#if HIVEC_DEBUG
+// TODO: remove:
+	[TOKEN_INTRINSIC_PRINTN] = "printn",
+#endif
+	[TOKEN_INTRINSIC_SWAP] = "swap"
+};
+static_assert(TOKEN_LAST_KEYWORD + 1 == TOKEN_FIRST_INTRINSIC,
+	"The keywords and intrinsics must stay one contiguous range of the types enum!");
+static_assert((TOKEN_LAST_INTRINSIC - TOKEN_FIRST_KEYWORD + 1) == wordsCount,
+	"The local `words` set is not synced with updated types enum!");
+
+// NOTE: bytes of the escape sequences, indexed by the symbol after the backslash. Symbols, that are
+//       not escapes, have 0 and stand for themselves.
+static const unsigned char escapes[256] =
+{
+	['a'] = '\a', ['b'] = '\b', ['f'] = '\f', ['n'] = '\n', ['r'] = '\r', ['t'] = '\t', ['v'] = '\v',
+	['\\'] = '\\', ['\''] = '\'', ['\"'] = '\"', ['?'] = '?'
 };
 
+static signed char Lexer_prepareSource(
+	struct Source* const source,
+	struct Queue* const logs);
+
+static signed char Lexer_loadSource(
+	struct Source* const source);
+
+static void Lexer_openRange(
+	struct Lexer* const lexer,
+	struct Arena* const arena,
+	const char* const begin,
+	const char* const end);
+
+static signed char Lexer_nextLine(
+	struct Lexer* const lexer);
+
+static void Lexer_lexChunks(
+	struct Tokens* const tokens,
+	const int64_t chunksCount);
+
+static void* Lexer_lexChunk(
+	void* const data);
+
+static int64_t Lexer_countChunks(
+	const int64_t length,
+	const int64_t threadsCount);
+
+static void Lexer_internSymbols(
+	struct Tokens* const tokens);
+
+static void Lexer_internSymbol(
+	struct Tokens* const tokens,
+	const int64_t token);
+
 static signed char Lexer_validateTokens(
 	const char* filePath,
-	struct List* const tokens,
+	struct Tokens* const tokens,
 	struct Queue* const logs);
 
-static void Lexer_lexLine(
-	struct LexerContext* const context,
-	struct List* const tokens);
+static void Lexer_reportInvalidToken(
+	const struct Tokens* const tokens,
+	const int64_t token,
+	struct Queue* const logs);
 
-static struct Token* Lexer_createToken(
-	void);
+static signed char Lexer_lexToken(
+	struct Lexer* const lexer,
+	struct Token* const token);
 
 static void Lexer_setupToken(
 	struct Token* const token,
-	const int64_t id,
-	const int64_t kind,
-	const struct Location location);
+	const enum TokenKind kind);
 
 static void Lexer_moveBy(
-	struct LexerContext* const context,
+	struct Lexer* const lexer,
 	const int64_t amount);
 
-static signed char Lexer_tryParseKeyword(
-	struct LexerContext* const context,
-	struct List* const tokens);
+static int64_t Lexer_lookupWord(
+	const char* word,
+	const int64_t wordLength);
+
+#if HIVEC_DEBUG
+static void Lexer_checkWords(
+	void);
+#endif
 
-static signed char Lexer_tryParseIntrinsic(
-	struct LexerContext* const context,
-	struct List* const tokens);
+static signed char Lexer_tryParseWord(
+	struct Lexer* const lexer,
+	struct Token* const token);
 
-static signed char Lexer_tryParseIdentifier(
-	struct LexerContext* const context,
-	struct List* const tokens);
+static signed char Lexer_decodeStringLiteral(
+	struct Arena* const arena,
+	const char* const literal,
+	const char* const end,
+	int64_t* const literalLength,
+	union TokenValue* const value);
 
-static signed char Lexer_tryParseLiteral(
-	struct LexerContext* const context,
-	struct List* const tokens);
+static enum LexerLiteralError Lexer_decodeIntegerLiteral(
+	const char* begin,
+	const char* const end,
+	int64_t* const value);
 
-static signed char Lexer_isWhitespace(
-	const char ch);
+static signed char Lexer_tryParseLiteral(
+	struct Lexer* const lexer,
+	struct Token* const token);
 
 static void Lexer_skipWhitespace(
-	struct LexerContext* const context);
+	struct Lexer* const lexer);
 
 signed char Lexer_lexFile(
-	const char* filePath,
-	struct List* const tokens,
+	struct Source* const source,
+	struct Tokens* const tokens,
+	const char* const cacheDirectory,
+	const int64_t threadsCount,
 	struct Queue* const logs)
 {
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The filePath, provided to this function, must never ever be null.
+	//     1. The source, provided to this function, must never ever be null.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(filePath != NULL);
+	assert(source != NULL);
 
-	// NOTE: not marking as debug-only.
+	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. Provided file path can theoretically be empty string, that, while
-	//        is possible behaviour, will fail at file reading. Therefore, this
-	//        check is necessary, to prevent compiler errors.
-	if (strlen(filePath) <= 0)
-	{
-		Queue_enqueue(logs, Log_create("lexer", SEVERITY_ERROR, INVALID_LOCATION, "provided source file path was empty!"));
-
-#if HIVEC_DEBUG
-		Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-			(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-			"locator of the log above this meesage."));
-#endif
-
-		return 0;
-	}
+	//     1. The source's file path must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(source->file != NULL);
 
 	// NOTE: using `assert` and not `if`
 	// REASONS:
@@ -114,6 +240,13 @@ signed char Lexer_lexFile(
 	//        and debug configuration.
 	assert(tokens != NULL);
 
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The threads count is resolved by the caller, and must never be less than one.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(threadsCount > 0);
+
 	// NOTE: using `assert` and not `if`
 	// REASONS:
 	//     1. The logs, provided to this function, must never ever be null.
@@ -121,440 +254,492 @@ signed char Lexer_lexFile(
 	//        and debug configuration.
 	assert(logs != NULL);
 
-	// Creating a lexer context
-	struct LexerContext context = {0};
-	// Setting up location
-	context.location = (struct Location) {.file = filePath, .line = 1, .column = 1 };
-	// Opening a provided file
-	FILE* file = fopen(filePath, "r");
+	const char* filePath = source->file;
 
-	// NOTE: not marking as debug-only.
-	// REASONS:
-	//     1. Opening file might actually fail (due to non-existing file path)
-	//        and must be checked and reported accordingly.
-	if (file == NULL)
+	if (!Lexer_prepareSource(source, logs))
 	{
-		Queue_enqueue(logs, Log_create("lexer", SEVERITY_ERROR, INVALID_LOCATION, "failed to open source file with path `%s`!", filePath));
+		return 0;
+	}
 
-#if HIVEC_DEBUG
-		Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-			(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-			"locator of the log above this meesage."));
-#endif
+	// NOTE: a source, whose tokens were cached by a previous run, is not lexed again.
+	struct CacheKey cacheKey = {0};
 
-		return 0;
+	if (cacheDirectory != NULL)
+	{
+		cacheKey = Cache_hash(source);
+
+		if (Cache_load(cacheDirectory, &cacheKey, source, tokens))
+		{
+			return Lexer_validateTokens(filePath, tokens, logs);
+		}
 	}
 
-	char* line = NULL;
-	int64_t length = 0;
-	int64_t read;
+	// NOTE: tokens never span lines, so big sources are split at new lines into chunks, that
+	//       are lexed in parallel.
+	const int64_t chunksCount = Lexer_countChunks(source->length, threadsCount);
 
-	while ((read = getline(&line, (long unsigned int*)&length, file)) != -1)
+	if (chunksCount > 1)
 	{
-		// Setting up line's pointers
-		context.begin = line;
-		context.current = line;
-		context.end = line + read;
-		// Lexing the file
-		Lexer_lexLine(&context, tokens);
-		// Updating location for the next line
-		++context.location.line;
-		context.location.column = 1;
+		Lexer_lexChunks(tokens, chunksCount);
+	}
+	else
+	{
+		// Decoded literals are allocated in the same arena as the tokens stream
+		struct Lexer lexer = {0};
+		Lexer_openRange(&lexer, tokens->arena, source->buffer, source->buffer + source->length);
+
+		for (struct Token token = {0}; Lexer_next(&lexer, &token);)
+		{
+			Tokens_push(tokens, &token);
+		}
+	}
+
+	// NOTE: interning after the chunks were appended, so equal symbols of different chunks
+	//       share one id.
+	Lexer_internSymbols(tokens);
+
+	if (!Lexer_validateTokens(filePath, tokens, logs))
+	{
+		return 0;
 	}
 
-	if (line != NULL)
+	// NOTE: not failing the compilation, the cache only saves the lexing of the next run.
+	if (cacheDirectory != NULL && !Cache_store(cacheDirectory, &cacheKey, source, tokens))
 	{
-		free(line);
+		Queue_enqueue(logs, Log_create("lexer", SEVERITY_WARNING, INVALID_LOCATION, "failed to store the tokens of file `%s` into cache directory `%s`!", filePath, cacheDirectory));
+
+#if HIVEC_DEBUG
+		Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+			(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+			"locator of the log above this meesage."));
+#endif
 	}
 
-	fclose(file);
-	return Lexer_validateTokens(filePath, tokens, logs);
+	return 1;
 }
 
-signed char Lexer_validateTokens(
-	const char* filePath,
-	struct List* const tokens,
+signed char Lexer_open(
+	struct Lexer* const lexer,
+	struct Arena* const arena,
+	struct Source* const source,
 	struct Queue* const logs)
 {
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The filePath, provided to this function, must never ever be null.
+	//     1. The lexer, provided to this function, must never ever be null.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(filePath != NULL);
+	assert(lexer != NULL);
 
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The tokens, provided to this function, must never ever be null.
+	//     1. The arena, provided to this function, must never ever be null.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(tokens != NULL);
+	assert(arena != NULL);
 
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The logs, provided to this function, must never ever be null.
+	//     1. The source, provided to this function, must never ever be null.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(logs != NULL);
+	assert(source != NULL);
 
-	// NOTES:
-	//     1. Since tokens count is validated here, it is not required to be logged in any
-	//        following subprocess. However, I advice to place asserts in all those places
-	//        to catch any possible developer-inflicted bugs.
-	//     2. In case the tokens list is empty (the source was empty of compilable code),
-	//        all the following processes must be skipped and all resources deallocated.
-	if (tokens->count <= 0)
+	// NOTE: the source is loaded by the first pull through it, the following ones only rewind.
+	if (source->buffer == NULL && !Lexer_prepareSource(source, logs))
 	{
-		Queue_enqueue(logs, Log_create("lexer", SEVERITY_ERROR, INVALID_LOCATION, "file `%s` was empty of compilable source which is forbidden!", filePath));
-
-#if HIVEC_DEBUG
-		Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-			(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-			"locator of the log above this meesage."));
-#endif
-
 		return 0;
 	}
 
-	signed char result = 1;
-
-	for (struct LNode* tokensIterator = tokens->front; tokensIterator != NULL; tokensIterator = tokensIterator->next)
-	{
-		// NOTE: using `assert` and not `if`
-		// REASONS:
-		//     1. The data of the tokens iterator node, in the list must never be
-		//        of value null.
-		//     2. This assert will prevent developers infliced bugs and development
-		//        and debug configuration.
-		assert(tokensIterator->data != NULL);
-
-		struct Token* token = (struct Token*)tokensIterator->data;
-
-		if (token->kind == TOKEN_INVALID)
-		{
-			Queue_enqueue(logs,
-				Log_create("lexer", SEVERITY_ERROR, token->location,
-					"encountered an invalid token `%.*s`!",
-					(signed int)token->source.length, token->source.buffer));
-
-#if HIVEC_DEBUG
-			Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-				(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-				"locator of the log above this meesage."));
-#endif
-
-			result = 0;
-		}
-	}
-
-	return result;
+	Lexer_openRange(lexer, arena, source->buffer, source->buffer + source->length);
+	return 1;
 }
 
-static void Lexer_lexLine(
-	struct LexerContext* const context,
-	struct List* const tokens)
+signed char Lexer_next(
+	struct Lexer* const lexer,
+	struct Token* const token)
 {
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The context, provided to this function, must never ever be null.
+	//     1. The lexer, provided to this function, must never ever be null.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(context != NULL);
+	assert(lexer != NULL);
 
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The tokens, provided to this function, must never ever be null.
+	//     1. The token, provided to this function, must never ever be null.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(tokens != NULL);
-
-	// Handlng empty line
-	if (context->begin == context->end || context->begin == NULL)
-	{
-		return;
-	}
+	assert(token != NULL);
 
-	for (context->current = context->begin; context->current < context->end;)
+	for (;;)
 	{
-		// Skip white space
-		Lexer_skipWhitespace(context);
-
-		// Check if line was only white spaces and return if so
-		if (context->current == context->end)
+		if (Lexer_lexToken(lexer, token))
 		{
-			return;
-		}
-
-		// Skip comment
-		if (context->current < context->end && *(context->current) == '/' && *(context->current + 1) == '/')
-		{
-			return;
+			return 1;
 		}
 
-		// Trying to parse keyword
-		if (Lexer_tryParseKeyword(context, tokens) != 0)
-		{
-			continue;
-		}
-		// Trying to parse intrinsic
-		else if (Lexer_tryParseIntrinsic(context, tokens) != 0)
-		{
-			continue;
-		}
-		// Trying to parse identifier
-		else if (Lexer_tryParseIdentifier(context, tokens) != 0)
-		{
-			continue;
-		}
-		// Trying to parse literal
-		else if (Lexer_tryParseLiteral(context, tokens) != 0)
-		{
-			continue;
-		}
-		else
+		// The current line is exhausted, moving onto the next one
+		if (!Lexer_nextLine(lexer))
 		{
-			// Pushing invalid token, since all parsers failed
-			struct Token* token = Lexer_createToken();
-			Lexer_setupToken(token, context->count++, TOKEN_INVALID, context->location);
-
-			const char* source = context->current;
-			int64_t sourceLength = 0;
-			for (; !Lexer_isWhitespace(*context->current); ++sourceLength) { Lexer_moveBy(context, 1); }
-
-			token->source.buffer = (char*)malloc((sourceLength) * sizeof(char));
-
-			// NOTE: using `assert` and not `if`
-			// REASONS:
-			//     1. The memory allocation errors can happen anytime, no matter build
-			//        configuration being debug or release. However, since the compiler
-			//        cannot prevent such bugs, I will leave it as assert. Worst case
-			//        scenario - the compiler crashes, and user re-runs it.
-			//     2. This assert will prevent developers infliced bugs and development
-			//        and debug configuration.
-			assert(token->source.buffer != NULL);
-
-			memcpy(token->source.buffer, source, sourceLength);
-			token->source.length = sourceLength;
-			List_push(tokens, (void* const)token);
+			return 0;
 		}
 	}
 }
 
-static struct Token* Lexer_createToken(
-	void)
+signed char Lexer_pushToken(
+	struct Tokens* const tokens,
+	const struct Token* const token,
+	struct Queue* const logs)
 {
-	struct Token* token = (struct Token*)malloc(sizeof(struct Token));
-
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The memory allocation errors can happen anytime, no matter build
-	//        configuration being debug or release. However, since the compiler
-	//        cannot prevent such bugs, I will leave it as assert. Worst case
-	//        scenario - the compiler crashes, and user re-runs it.
+	//     1. The tokens, provided to this function, must never ever be null.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(token != NULL);
-
-	return token;
-}
+	assert(tokens != NULL);
 
-static void Lexer_setupToken(
-	struct Token* const token,
-	const int64_t id,
-	const int64_t kind,
-	const struct Location location)
-{
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The token, provided to this function, must never ever be null.
+	//     1. The logs, provided to this function, must never ever be null.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(token != NULL);
+	assert(logs != NULL);
 
-	token->id = id;
-	token->kind = kind;
-	token->location = location;
-	token->nextRef = NULL;
-	token->previousRef = NULL;
+	const int64_t id = Tokens_push(tokens, token);
+	Lexer_internSymbol(tokens, id);
 
+	if (tokens->kinds[id] == TOKEN_INVALID)
 	{
-		char buffer[128 + 1];
-		int64_t length = snprintf(buffer, 128, "%p_%ld", (void*)token, id);
-		assert(length >= 0);
-		buffer[length] = 0;
-		token->hash = hash256(buffer, length);
+		Lexer_reportInvalidToken(tokens, id, logs);
+		return 0;
 	}
+
+	return 1;
 }
 
-static void Lexer_moveBy(
-	struct LexerContext* const context,
-	const int64_t amount)
+static void Lexer_openRange(
+	struct Lexer* const lexer,
+	struct Arena* const arena,
+	const char* const begin,
+	const char* const end)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The lexer, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(lexer != NULL);
+
+	// NOTE: starting before the first line with an empty one, so the first `Lexer_next` moves
+	//       onto the first line of the range.
+	lexer->arena = arena;
+	lexer->begin = begin;
+	lexer->current = begin;
+	lexer->end = begin;
+	lexer->next = begin;
+	lexer->last = end;
+}
+
+static signed char Lexer_nextLine(
+	struct Lexer* const lexer)
 {
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The context, provided to this function, must never ever be null.
+	//     1. The lexer, provided to this function, must never ever be null.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(context != NULL);
+	assert(lexer != NULL);
 
-	for (int64_t i = 0; i < amount && context->current < context->end; ++i)
+	if (lexer->next >= lexer->last)
 	{
-		++context->current;
-		++context->location.column;
+		return 0;
 	}
+
+	// Lines keep their trailing new line, the same way `getline` returned them
+	const char* newline = (const char*)memchr(lexer->next, '\n', lexer->last - lexer->next);
+
+	// Setting up line's pointers
+	lexer->begin = lexer->next;
+	lexer->current = lexer->next;
+	lexer->end = newline != NULL ? newline + 1 : lexer->last;
+	lexer->next = lexer->end;
+	return 1;
 }
 
-static signed char Lexer_tryParseKeyword(
-	struct LexerContext* const context,
-	struct List* const tokens)
+static void Lexer_lexChunks(
+	struct Tokens* const tokens,
+	const int64_t chunksCount)
 {
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The context, provided to this function, must never ever be null.
+	//     1. The tokens, provided to this function, must never ever be null.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(context != NULL);
+	assert(tokens != NULL);
 
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The tokens, provided to this function, must never ever be null.
+	//     1. Chunks count must be in the supported range.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(tokens != NULL);
+	assert(chunksCount > 1 && chunksCount <= LEXER_MAXIMAL_CHUNKS_COUNT);
 
-	// NOTE: this `keywordsCount` define must be changed when modifying the `keywords` set!
-	#define keywordsCount ((int64_t)11)
-	const char* keywords[] =
-	{
-		[TOKEN_KEYWORD_MAIN] = "main",
-		[TOKEN_KEYWORD_I64] = "i64",
-		[TOKEN_KEYWORD_P64] = "p64",
-		[TOKEN_KEYWORD_IF] = "if",
-		[TOKEN_KEYWORD_ELSE] = "else",
-		[TOKEN_KEYWORD_WHILE] = "while",
-		[TOKEN_KEYWORD_PROCEDURE] = "procedure",
-		[TOKEN_KEYWORD_REQUIRE] = "require",
-		[TOKEN_KEYWORD_RETURN] = "return",
-		[TOKEN_KEYWORD_DO] = "do",
-		[TOKEN_KEYWORD_END] = "end"
-	};
-	static_assert((TOKEN_LAST_KEYWORD - TOKEN_FIRST_KEYWORD + 1) == keywordsCount,
-		"The local `keywords` set is not synced with updated types enum!");
+	struct Source* source = tokens->source;
+	const char* const end = source->buffer + source->length;
+	struct LexerChunk chunks[LEXER_MAXIMAL_CHUNKS_COUNT];
+	pthread_t workers[LEXER_MAXIMAL_CHUNKS_COUNT];
+	signed char spawned[LEXER_MAXIMAL_CHUNKS_COUNT] = {0};
 
-	int64_t wordLength = 0;
-	for (const char* temp = context->current; !Lexer_isWhitespace(*temp) && temp != context->end; ++temp)
-		++wordLength;
+	// NOTE: the chunks are of about the same length, and every chunk, apart the last one, ends
+	//       right after a new line. So the split only depends on the source and the chunks count.
+	const char* begin = source->buffer;
 
-	for (int64_t type = TOKEN_FIRST_KEYWORD; type <= TOKEN_LAST_KEYWORD; ++type)
+	for (int64_t index = 0; index < chunksCount; ++index)
 	{
-		const char* keyword = keywords[type];
-		const int64_t keywordLength = strlen(keyword);
+		const char* chunkEnd = end;
 
-		if ((wordLength == keywordLength) && (strncmp(context->current, keyword, keywordLength) == 0))
+		if (index < chunksCount - 1)
 		{
-			struct Token* token = Lexer_createToken();
-			Lexer_setupToken(token, context->count++, type, context->location);
+			const char* target = source->buffer + source->length / chunksCount * (index + 1);
+			target = target > begin ? target : begin;
+			const char* newline = (const char*)memchr(target, '\n', end - target);
+			chunkEnd = newline != NULL ? newline + 1 : end;
+		}
 
-			token->source.buffer = (char*)malloc((wordLength) * sizeof(char));
+		struct LexerChunk* chunk = &chunks[index];
+		chunk->begin = begin;
+		chunk->end = chunkEnd;
+		chunk->arena = Arena_create();
+		chunk->tokens = Tokens_create(&chunk->arena, source);
+		begin = chunkEnd;
+	}
 
-			// NOTE: using `assert` and not `if`
-			// REASONS:
-			//     1. The memory allocation errors can happen anytime, no matter build
-			//        configuration being debug or release. However, since the compiler
-			//        cannot prevent such bugs, I will leave it as assert. Worst case
-			//        scenario - the compiler crashes, and user re-runs it.
-			//     2. This assert will prevent developers infliced bugs and development
-			//        and debug configuration.
-			assert(token->source.buffer != NULL);
+	// NOTE: the first chunk is lexed on the calling thread. In case a worker cannot be
+	//       spawned, its chunk is lexed on the calling thread too.
+	for (int64_t index = 1; index < chunksCount; ++index)
+	{
+		spawned[index] = pthread_create(&workers[index], NULL, Lexer_lexChunk, &chunks[index]) == 0;
+	}
 
-			// Copying identifier name over to the token
-			memcpy(token->source.buffer, context->current, wordLength);
-			token->source.length = wordLength;
+	Lexer_lexChunk(&chunks[0]);
 
-			List_push(tokens, (void* const)token);
-			Lexer_moveBy(context, wordLength);
-			return 1;
+	for (int64_t index = 1; index < chunksCount; ++index)
+	{
+		if (spawned[index])
+		{
+			pthread_join(workers[index], NULL);
+		}
+		else
+		{
+			Lexer_lexChunk(&chunks[index]);
 		}
 	}
 
-	return 0;
+	// NOTE: stitching in the source order. The tokens' offsets are into the whole source, so
+	//       they are appended as they are.
+	for (int64_t index = 0; index < chunksCount; ++index)
+	{
+		Tokens_append(tokens, &chunks[index].tokens);
+
+		// Decoded literals were allocated in the chunk's arena and must live as long as the tokens
+		Arena_adopt(tokens->arena, &chunks[index].arena);
+	}
 }
 
-static signed char Lexer_tryParseIntrinsic(
-	struct LexerContext* const context,
-	struct List* const tokens)
+static void* Lexer_lexChunk(
+	void* const data)
 {
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The context, provided to this function, must never ever be null.
-	//     2. This assert will prevent developers infliced bugs and development
-	//        and debug configuration.
-	assert(context != NULL);
-
-	// NOTE: using `assert` and not `if`
-	// REASONS:
-	//     1. The tokens, provided to this function, must never ever be null.
+	//     1. The chunk, provided to this function, must never ever be null.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(tokens != NULL);
-
-	// NOTE: this `intrinsicsCount` define must be changed when modifying the `intrinsics` set!
-#if HIVEC_DEBUG
-// TODO: remove:
-	#define intrinsicsCount ((int64_t)26)
-#else
-	#define intrinsicsCount ((int64_t)25)
-#endif
-	static const char* intrinsics[] =
-	{
-		[TOKEN_INTRINSIC_ADD] = "add",
-		[TOKEN_INTRINSIC_SUBTRACT] = "subtract",
-		[TOKEN_INTRINSIC_MULTIPLY] = "multiply",
-		[TOKEN_INTRINSIC_DIVIDE] = "divide",
-		[TOKEN_INTRINSIC_MODULUS] = "modulus",
-		[TOKEN_INTRINSIC_EQUAL] = "equal",
-		[TOKEN_INTRINSIC_NEQUAL] = "nequal",
-		[TOKEN_INTRINSIC_GREATER] = "greater",
-		[TOKEN_INTRINSIC_LESS] = "less",
-		[TOKEN_INTRINSIC_BAND] = "band",
-		[TOKEN_INTRINSIC_BOR] = "bor",
-		[TOKEN_INTRINSIC_BNOT] = "bnot",
-		[TOKEN_INTRINSIC_SHIFTL] = "shiftl",
-		[TOKEN_INTRINSIC_SHIFTR] = "shiftr",
-		[TOKEN_INTRINSIC_SYSCALL0] = "syscall0",
-		[TOKEN_INTRINSIC_SYSCALL1] = "syscall1",
-		[TOKEN_INTRINSIC_SYSCALL2] = "syscall2",
-		[TOKEN_INTRINSIC_SYSCALL3] = "syscall3",
-		[TOKEN_INTRINSIC_SYSCALL4] = "syscall4",
-		[TOKEN_INTRINSIC_SYSCALL5] = "syscall5",
-		[TOKEN_INTRINSIC_SYSCALL6] = "syscall6",
-		[TOKEN_INTRINSIC_CLONE] = "clone",
-		[TOKEN_INTRINSIC_DROP] = "drop",
-		[TOKEN_INTRINSIC_OVER] = "over",
-#if HIVEC_DEBUG
-// TODO: remove:
-		[TOKEN_INTRINSIC_PRINTN] = "printn",
-#endif
-		[TOKEN_INTRINSIC_SWAP] = "swap"
-	};
-	static_assert((TOKEN_LAST_INTRINSIC- TOKEN_FIRST_INTRINSIC + 1) == intrinsicsCount,
-		"The local `intrinsics` set is not synced with updated types enum!");
+	assert(data != NULL);
 
-	int64_t wordLength = 0;
-	for (const char* temp = context->current; !Lexer_isWhitespace(*temp) && temp != context->end; ++temp)
-		++wordLength;
+	struct LexerChunk* chunk = (struct LexerChunk*)data;
+	struct Lexer lexer = {0};
+	Lexer_openRange(&lexer, &chunk->arena, chunk->begin, chunk->end);
 
-	for (int64_t type = TOKEN_FIRST_INTRINSIC; type <= TOKEN_LAST_INTRINSIC; ++type)
+	for (struct Token token = {0}; Lexer_next(&lexer, &token);)
 	{
-		const char* intrinsic = intrinsics[type];
-		const int64_t intrensicLength = strlen(intrinsic);
+		Tokens_push(&chunk->tokens, &token);
+	}
+
+	return NULL;
+}
+
+static int64_t Lexer_countChunks(
+	const int64_t length,
+	const int64_t threadsCount)
+{
+	int64_t chunksCount = length / LEXER_MINIMAL_CHUNK_LENGTH;
+
+	if (chunksCount > threadsCount)
+	{
+		chunksCount = threadsCount;
+	}
+
+	if (chunksCount > LEXER_MAXIMAL_CHUNKS_COUNT)
+	{
+		chunksCount = LEXER_MAXIMAL_CHUNKS_COUNT;
+	}
+
+	return chunksCount > 1 ? chunksCount : 1;
+}
+
+static signed char Lexer_prepareSource(
+	struct Source* const source,
+	struct Queue* const logs)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The source, provided to this function, must never ever be null, and must have
+	//        the file path.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(source != NULL && source->file != NULL);
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The logs, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(logs != NULL);
+
+	const char* filePath = source->file;
+
+	// NOTE: not marking as debug-only.
+	// REASONS:
+	//     1. Provided file path can theoretically be empty string, that, while
+	//        is possible behaviour, will fail at file reading. Therefore, this
+	//        check is necessary, to prevent compiler errors.
+	if (strlen(filePath) <= 0)
+	{
+		Queue_enqueue(logs, Log_create("lexer", SEVERITY_ERROR, INVALID_LOCATION, "provided source file path was empty!"));
+
+#if HIVEC_DEBUG
+		Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+			(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+			"locator of the log above this meesage."));
+#endif
+
+		return 0;
+	}
+
+#if HIVEC_DEBUG
+	// Making sure the words lookup is in sync with the `words` set
+	Lexer_checkWords();
+#endif
+
+	// NOTE: not marking as debug-only.
+	// REASONS:
+	//     1. Opening or reading file might actually fail (due to non-existing file
+	//        path) and must be checked and reported accordingly.
+	//     2. The source buffer outlives the lexer: tokens only point into it, so it is
+	//        released by the owner of the source with `Source_destroy`.
+	if (!Lexer_loadSource(source))
+	{
+		Queue_enqueue(logs, Log_create("lexer", SEVERITY_ERROR, INVALID_LOCATION, "failed to open source file with path `%s`!", filePath));
+
+#if HIVEC_DEBUG
+		Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+			(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+			"locator of the log above this meesage."));
+#endif
+
+		return 0;
+	}
+
+	// NOTE: not marking as debug-only.
+	// REASONS:
+	//     1. The tokens' offsets are 32-bit, so the tokens of longer sources could not be
+	//        located, which must be reported instead of producing wrong locations.
+	if (source->length > TOKENS_MAXIMAL_SOURCE_LENGTH)
+	{
+		Queue_enqueue(logs, Log_create("lexer", SEVERITY_ERROR, INVALID_LOCATION, "file `%s` is longer than the supported %ld bytes!", filePath, TOKENS_MAXIMAL_SOURCE_LENGTH));
+
+#if HIVEC_DEBUG
+		Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+			(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+			"locator of the log above this meesage."));
+#endif
+
+		return 0;
+	}
+
+	return 1;
+}
+
+static signed char Lexer_loadSource(
+	struct Source* const source)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The source, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(source != NULL);
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The source must not be loaded twice, otherwise its buffer would leak.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(source->buffer == NULL);
+
+	signed int descriptor = open(source->file, O_RDONLY);
+
+	if (descriptor < 0)
+	{
+		return 0;
+	}
+
+	struct stat status = {0};
+
+	if (fstat(descriptor, &status) != 0)
+	{
+		close(descriptor);
+		return 0;
+	}
+
+	// NOTES:
+	//     1. Regular files are mapped read-only as a whole, so the lexer scans one contiguous
+	//        buffer and no line is ever copied or reallocated.
+	//     2. An empty regular file cannot be mapped, but it also has nothing to be lexed.
+	//     3. In case mapping fails, the file is read the same way as pipes are.
+	if (S_ISREG(status.st_mode) && status.st_size > 0)
+	{
+		void* mapping = mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
 
-		if ((wordLength == intrensicLength) && (strncmp(context->current, intrinsic, intrensicLength) == 0))
+		if (mapping != MAP_FAILED)
 		{
-			struct Token* token = Lexer_createToken();
-			Lexer_setupToken(token, context->count++, type, context->location);
+			(void)madvise(mapping, (size_t)status.st_size, MADV_SEQUENTIAL);
+			close(descriptor);
 
-			token->source.buffer = (char*)malloc((wordLength) * sizeof(char));
+			source->buffer = (char*)mapping;
+			source->length = (int64_t)status.st_size;
+			source->isMapped = 1;
+			return 1;
+		}
+	}
+	else if (S_ISREG(status.st_mode))
+	{
+		close(descriptor);
+		return 1;
+	}
+
+	// NOTE: pipes, character devices (like `/dev/stdin`), and files, which failed to be
+	//       mapped, have no known size and are read in doubling chunks.
+	int64_t capacity = 0;
+
+	for (;;)
+	{
+		if (source->length >= capacity)
+		{
+			capacity = capacity > 0 ? capacity * 2 : (int64_t)(64 * 1024);
+			source->buffer = (char*)realloc(source->buffer, capacity * sizeof(char));
 
 			// NOTE: using `assert` and not `if`
 			// REASONS:
@@ -564,40 +749,92 @@ static signed char Lexer_tryParseIntrinsic(
 			//        scenario - the compiler crashes, and user re-runs it.
 			//     2. This assert will prevent developers infliced bugs and development
 			//        and debug configuration.
-			assert(token->source.buffer != NULL);
+			assert(source->buffer != NULL);
+		}
 
-			// Copying identifier name over to the token
-			memcpy(token->source.buffer, context->current, wordLength);
-			token->source.length = wordLength;
+		ssize_t bytesRead = read(descriptor, source->buffer + source->length, (size_t)(capacity - source->length));
 
-			List_push(tokens, token);
-			Lexer_moveBy(context, wordLength);
-			return 1;
+		if (bytesRead < 0 && errno == EINTR)
+		{
+			continue;
+		}
+
+		if (bytesRead < 0)
+		{
+			free(source->buffer);
+			source->buffer = NULL;
+			source->length = 0;
+			close(descriptor);
+			return 0;
+		}
+
+		if (bytesRead == 0)
+		{
+			break;
 		}
+
+		source->length += (int64_t)bytesRead;
 	}
 
-	return 0;
+	close(descriptor);
+	return 1;
 }
 
-static signed char Lexer_isIdentifierChar(
-	const char ch)
+static void Lexer_internSymbols(
+	struct Tokens* const tokens)
 {
-	return ch == '_'
-		|| ch == '?'
-		|| isalpha(ch)
-		|| isdigit(ch);
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The tokens, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(tokens != NULL);
+
+	for (int64_t token = 0; token < tokens->count; ++token)
+	{
+		Lexer_internSymbol(tokens, token);
+	}
 }
 
-static signed char Lexer_tryParseIdentifier(
-	struct LexerContext* const context,
-	struct List* const tokens)
+static void Lexer_internSymbol(
+	struct Tokens* const tokens,
+	const int64_t token)
 {
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The context, provided to this function, must never ever be null.
+	//     1. The tokens, provided to this function, must never ever be null, and the token
+	//        must be one of them.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(tokens != NULL && token >= 0 && token < tokens->count);
+
+	switch (tokens->kinds[token])
+	{
+		// NOTE: `main` is a procedure name too, so it is interned with the identifiers.
+		case TOKEN_IDENTIFIER:
+		case TOKEN_KEYWORD_MAIN:
+		case TOKEN_LITERAL_STRING:
+		{
+			tokens->symbolIds[token] = Symbols_intern(&tokens->symbols, Tokens_source(tokens, token), tokens->lengths[token]);
+		} break;
+
+		default:
+		{
+		} break;
+	}
+}
+
+signed char Lexer_validateTokens(
+	const char* filePath,
+	struct Tokens* const tokens,
+	struct Queue* const logs)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The filePath, provided to this function, must never ever be null.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(context != NULL);
+	assert(filePath != NULL);
 
 	// NOTE: using `assert` and not `if`
 	// REASONS:
@@ -606,352 +843,709 @@ static signed char Lexer_tryParseIdentifier(
 	//        and debug configuration.
 	assert(tokens != NULL);
 
-	// Checking for invalid first symbol
-	if (!(Lexer_isIdentifierChar(*context->current) && !isdigit(*context->current)))
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The logs, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(logs != NULL);
+
+	// NOTES:
+	//     1. Since tokens count is validated here, it is not required to be logged in any
+	//        following subprocess. However, I advice to place asserts in all those places
+	//        to catch any possible developer-inflicted bugs.
+	//     2. In case the tokens list is empty (the source was empty of compilable code),
+	//        all the following processes must be skipped and all resources deallocated.
+	if (tokens->count <= 0)
 	{
+		Queue_enqueue(logs, Log_create("lexer", SEVERITY_ERROR, INVALID_LOCATION, "file `%s` was empty of compilable source which is forbidden!", filePath));
+
+#if HIVEC_DEBUG
+		Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+			(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+			"locator of the log above this meesage."));
+#endif
+
 		return 0;
 	}
 
-	int64_t wordLength = 0;
-	for (const char* temp = context->current; !Lexer_isWhitespace(*temp) && Lexer_isIdentifierChar(*temp) && temp != context->end; ++temp)
-		++wordLength;
+	signed char result = 1;
 
-	// Handle not an identifier word error
-	if (wordLength <= 0)
+	for (int64_t token = 0; token < tokens->count; ++token)
 	{
-		return 0;
+		if (tokens->kinds[token] == TOKEN_INVALID)
+		{
+			Lexer_reportInvalidToken(tokens, token, logs);
+			result = 0;
+		}
+	}
+
+	return result;
+}
+
+static void Lexer_reportInvalidToken(
+	const struct Tokens* const tokens,
+	const int64_t token,
+	struct Queue* const logs)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. Only the invalid tokens are reported, their value holds the reason.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(tokens != NULL && token >= 0 && token < tokens->count && tokens->kinds[token] == TOKEN_INVALID);
+
+	switch ((enum LexerLiteralError)tokens->values[token].i64)
+	{
+		case LEXER_LITERAL_ERROR_MALFORMED:
+		{
+			Queue_enqueue(logs,
+				Log_create("lexer", SEVERITY_ERROR, Tokens_location(tokens, token),
+					"encountered a malformed numerical literal `%.*s`!",
+					(signed int)tokens->lengths[token], Tokens_source(tokens, token)));
+		} break;
+
+		case LEXER_LITERAL_ERROR_OVERFLOW:
+		{
+			Queue_enqueue(logs,
+				Log_create("lexer", SEVERITY_ERROR, Tokens_location(tokens, token),
+					"numerical literal `%.*s` does not fit into the i64 type!",
+					(signed int)tokens->lengths[token], Tokens_source(tokens, token)));
+		} break;
+
+		default:
+		{
+			Queue_enqueue(logs,
+				Log_create("lexer", SEVERITY_ERROR, Tokens_location(tokens, token),
+					"encountered an invalid token `%.*s`!",
+					(signed int)tokens->lengths[token], Tokens_source(tokens, token)));
+		} break;
 	}
 
-	struct Token* token = Lexer_createToken();
-	Lexer_setupToken(token, context->count++, TOKEN_IDENTIFIER, context->location);
+#if HIVEC_DEBUG
+	Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+		(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+		"locator of the log above this meesage."));
+#endif
+}
 
-	token->source.buffer = (char*)malloc((wordLength) * sizeof(char));
+static signed char Lexer_lexToken(
+	struct Lexer* const lexer,
+	struct Token* const token)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The lexer, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(lexer != NULL);
 
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The memory allocation errors can happen anytime, no matter build
-	//        configuration being debug or release. However, since the compiler
-	//        cannot prevent such bugs, I will leave it as assert. Worst case
-	//        scenario - the compiler crashes, and user re-runs it.
+	//     1. The token, provided to this function, must never ever be null.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(token->source.buffer != NULL);
+	assert(token != NULL);
 
-	// Copying identifier name over to the token
-	memcpy(token->source.buffer, context->current, wordLength);
-	token->source.length = wordLength;
+	// Handlng empty or exhausted line
+	if (lexer->current >= lexer->end)
+	{
+		return 0;
+	}
+
+	// Skip white space
+	Lexer_skipWhitespace(lexer);
+
+	// Check if the rest of the line was only white spaces and return if so
+	if (lexer->current == lexer->end)
+	{
+		return 0;
+	}
+
+	// Skip comment
+	if (lexer->current + 1 < lexer->end && *(lexer->current) == '/' && *(lexer->current + 1) == '/')
+	{
+		Lexer_moveBy(lexer, lexer->end - lexer->current);
+		return 0;
+	}
 
-	List_push(tokens, token);
-	Lexer_moveBy(context, wordLength);
+	// Trying to parse keyword, intrinsic or identifier
+	if (Lexer_tryParseWord(lexer, token) != 0)
+	{
+		return 1;
+	}
+	// Trying to parse literal
+	else if (Lexer_tryParseLiteral(lexer, token) != 0)
+	{
+		return 1;
+	}
+
+	// Producing invalid token, since all parsers failed
+	Lexer_setupToken(token, TOKEN_INVALID);
+
+	// Pointing the token's source view into the source buffer
+	token->source.buffer = lexer->current;
+	token->source.length = Scanner_skipWord(lexer->current, lexer->end) - lexer->current;
+	Lexer_moveBy(lexer, token->source.length);
 	return 1;
 }
 
-static signed char Lexer_tryParseLiteral(
-	struct LexerContext* const context,
-	struct List* const tokens)
+static void Lexer_setupToken(
+	struct Token* const token,
+	const enum TokenKind kind)
 {
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The context, provided to this function, must never ever be null.
+	//     1. The token, provided to this function, must never ever be null.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(context != NULL);
+	assert(token != NULL);
 
+	token->kind = kind;
+	token->value.i64 = 0;
+}
+
+static void Lexer_moveBy(
+	struct Lexer* const lexer,
+	const int64_t amount)
+{
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The tokens, provided to this function, must never ever be null.
+	//     1. The lexer, provided to this function, must never ever be null.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(tokens != NULL);
+	assert(lexer != NULL);
 
-	// Try parse string literal
-	if (*context->current == '\"')
-	{
-		const char* literal = context->current + 1;
-		int64_t literalLength = 0;
+	// NOTE: tokens only keep their offsets, so moving within the line is just advancing the
+	//       current pointer (never past the end of the line).
+	lexer->current += amount < lexer->end - lexer->current ? amount : lexer->end - lexer->current;
+}
 
-		for (const char* iterator = context->current + 1; 1; ++iterator, ++literalLength)
-		{
-			if (*(iterator) == '\"' && (iterator - 1 >= context->begin) && *(iterator - 1) != '\"') break;
-			if (*(iterator) == '\"' && (iterator - 2 >= context->begin) && *(iterator - 1) == '\"' && *(iterator - 2) == '\"') break;
-		}
+static int64_t Lexer_lookupWord(
+	const char* word,
+	const int64_t wordLength)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The word, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(word != NULL);
 
-		int64_t bytesLength = 0;
+	// NOTES:
+	//     1. The length and at most two characters pick the only possible candidate, which
+	//        is then confirmed with a single compare, instead of comparing with every word.
+	//     2. This switch must be updated together with the `words` set. In debug builds the
+	//        `Lexer_checkWords` makes sure every word is still found by it.
+	int64_t candidate = TOKEN_INVALID;
 
-		for (int64_t index = 0; index < literalLength; ++index, ++bytesLength)
+	switch (wordLength)
+	{
+		case 2:
 		{
-			if (literal[index] == '\\' && index + 1 < literalLength)
+			switch (word[0])
 			{
-				switch (literal[index + 1])
-				{
-					case 'a':
-					{
-						bytesLength -= 1;
-					} break;
+				case 'i': { candidate = TOKEN_KEYWORD_IF; } break;
+				case 'd': { candidate = TOKEN_KEYWORD_DO; } break;
+				default: { } break;
+			}
+		} break;
 
-					case 'b':
-					{
-						bytesLength -= 1;
-					} break;
+		case 3:
+		{
+			switch (word[0])
+			{
+				case 'i': { candidate = TOKEN_KEYWORD_I64; } break;
+				case 'p': { candidate = TOKEN_KEYWORD_P64; } break;
+				case 'e': { candidate = TOKEN_KEYWORD_END; } break;
+				case 'a': { candidate = TOKEN_INTRINSIC_ADD; } break;
+				case 'b': { candidate = TOKEN_INTRINSIC_BOR; } break;
+				default: { } break;
+			}
+		} break;
 
-					case 'f':
-					{
-						bytesLength -= 1;
-					} break;
+		case 4:
+		{
+			switch (word[0])
+			{
+				case 'm': { candidate = TOKEN_KEYWORD_MAIN; } break;
+				case 'e': { candidate = TOKEN_KEYWORD_ELSE; } break;
+				case 'l': { candidate = TOKEN_INTRINSIC_LESS; } break;
+				case 'b': { candidate = word[1] == 'a' ? TOKEN_INTRINSIC_BAND : TOKEN_INTRINSIC_BNOT; } break;
+				case 'd': { candidate = TOKEN_INTRINSIC_DROP; } break;
+				case 'o': { candidate = TOKEN_INTRINSIC_OVER; } break;
+				case 's': { candidate = TOKEN_INTRINSIC_SWAP; } break;
+				default: { } break;
+			}
+		} break;
 
-					case 'n':
-					{
-						bytesLength -= 1;
-					} break;
+		case 5:
+		{
+			switch (word[0])
+			{
+				case 'w': { candidate = TOKEN_KEYWORD_WHILE; } break;
+				case 'e': { candidate = TOKEN_INTRINSIC_EQUAL; } break;
+				case 'c': { candidate = TOKEN_INTRINSIC_CLONE; } break;
+				default: { } break;
+			}
+		} break;
 
-					case 'r':
-					{
-						bytesLength -= 1;
-					} break;
+		case 6:
+		{
+			switch (word[0])
+			{
+				case 'r': { candidate = TOKEN_KEYWORD_RETURN; } break;
+				case 'd': { candidate = TOKEN_INTRINSIC_DIVIDE; } break;
+				case 'n': { candidate = TOKEN_INTRINSIC_NEQUAL; } break;
+				case 's': { candidate = word[5] == 'l' ? TOKEN_INTRINSIC_SHIFTL : TOKEN_INTRINSIC_SHIFTR; } break;
+#if HIVEC_DEBUG
+// TODO: remove:
+				case 'p': { candidate = TOKEN_INTRINSIC_PRINTN; } break;
+#endif
+				default: { } break;
+			}
+		} break;
 
-					case 't':
-					{
-						bytesLength -= 1;
-					} break;
+		case 7:
+		{
+			switch (word[0])
+			{
+				case 'r': { candidate = TOKEN_KEYWORD_REQUIRE; } break;
+				case 'm': { candidate = TOKEN_INTRINSIC_MODULUS; } break;
+				case 'g': { candidate = TOKEN_INTRINSIC_GREATER; } break;
+				default: { } break;
+			}
+		} break;
 
-					case 'v':
+		case 8:
+		{
+			switch (word[0])
+			{
+				case 'm': { candidate = TOKEN_INTRINSIC_MULTIPLY; } break;
+				case 's':
+				{
+					// NOTE: `syscall0` to `syscall6` are sequential in the types enum.
+					if (word[1] == 'u')
 					{
-						bytesLength -= 1;
-					} break;
-
-					case '\\':
+						candidate = TOKEN_INTRINSIC_SUBTRACT;
+					}
+					else if (word[7] >= '0' && word[7] <= '6')
 					{
-						bytesLength -= 1;
-					} break;
+						candidate = TOKEN_INTRINSIC_SYSCALL0 + (word[7] - '0');
+					}
+				} break;
+				default: { } break;
+			}
+		} break;
 
-					case '\'':
-					{
-						bytesLength -= 0;
-					} break;
+		case 9:
+		{
+			switch (word[0])
+			{
+				case 'p': { candidate = TOKEN_KEYWORD_PROCEDURE; } break;
+				default: { } break;
+			}
+		} break;
 
-					case '\"':
-					{
-						bytesLength -= 1;
-					} break;
+		default:
+		{
+		} break;
+	}
 
-					case '\?':
-					{
-						bytesLength -= 1;
-					} break;
+	if (candidate != TOKEN_INVALID && memcmp(word, words[candidate], wordLength) == 0)
+	{
+		return candidate;
+	}
 
-					default:
-					{
-					} break;
-				}
-			}
-		}
+	return TOKEN_INVALID;
+}
+
+#if HIVEC_DEBUG
+static void Lexer_checkWords(
+	void)
+{
+	static signed char checked = 0;
 
-		unsigned char* bytes = (unsigned char*)malloc((bytesLength) * sizeof(unsigned char));
+	if (checked)
+	{
+		return;
+	}
 
+	for (int64_t type = TOKEN_FIRST_KEYWORD; type <= TOKEN_LAST_INTRINSIC; ++type)
+	{
 		// NOTE: using `assert` and not `if`
 		// REASONS:
-		//     1. The memory allocation errors can happen anytime, no matter build
-		//        configuration being debug or release. However, since the compiler
-		//        cannot prevent such bugs, I will leave it as assert. Worst case
-		//        scenario - the compiler crashes, and user re-runs it.
+		//     1. Every word of the `words` set must be found by the lookup, otherwise
+		//        the lookup's switch was not updated together with the types enum.
 		//     2. This assert will prevent developers infliced bugs and development
 		//        and debug configuration.
-		assert(bytes != NULL);
+		assert(words[type] != NULL && Lexer_lookupWord(words[type], (int64_t)strlen(words[type])) == type);
+	}
+
+	checked = 1;
+}
+#endif
+
+static signed char Lexer_isIdentifierChar(
+	const char ch)
+{
+	return (scannerClasses[(unsigned char)ch] & SCANNER_CLASS_IDENTIFIER) != 0;
+}
 
-		for (int64_t index = 0, iter = 0; index < literalLength;)
+static signed char Lexer_tryParseWord(
+	struct Lexer* const lexer,
+	struct Token* const token)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The lexer, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(lexer != NULL);
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The token, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(token != NULL);
+
+	// NOTE: measuring the identifier prefix and then the rest of the word (up to a whitespace)
+	//       from where the prefix ended. Keywords and intrinsics must match the whole word,
+	//       identifiers end at the first non-identifier symbol.
+	const char* identifierEnd = Scanner_skipIdentifier(lexer->current, lexer->end);
+	const char* wordEnd = Scanner_skipWord(identifierEnd, lexer->end);
+	int64_t wordLength = wordEnd - lexer->current;
+	const int64_t identifierLength = identifierEnd - lexer->current;
+
+	enum TokenKind kind = (enum TokenKind)Lexer_lookupWord(lexer->current, wordLength);
+
+	if (kind == TOKEN_INVALID)
+	{
+		// Checking for invalid first symbol
+		if (!Lexer_isIdentifierChar(*lexer->current) || (scannerClasses[(unsigned char)*lexer->current] & SCANNER_CLASS_DIGIT))
 		{
-			if (literal[index] == '\\' && index + 2 <= literalLength)
-			{
-				switch (literal[index + 1])
-				{
-					case 'a':
-					{
-						memset(bytes + iter, '\a', 1);
-						++iter;
-						index += 2;
-					} break;
+			return 0;
+		}
 
-					case 'b':
-					{
-						memset(bytes + iter, '\b', 1);
-						++iter;
-						index += 2;
-					} break;
+		// Handle not an identifier word error
+		if (identifierLength <= 0)
+		{
+			return 0;
+		}
 
-					case 'f':
-					{
-						memset(bytes + iter, '\f', 1);
-						++iter;
-						index += 2;
-					} break;
+		kind = TOKEN_IDENTIFIER;
+		wordLength = identifierLength;
+	}
 
-					case 'n':
-					{
-						memset(bytes + iter, '\n', 1);
-						++iter;
-						index += 2;
-					} break;
+	Lexer_setupToken(token, kind);
 
-					case 'r':
-					{
-						memset(bytes + iter, '\r', 1);
-						++iter;
-						index += 2;
-					} break;
+	// Pointing the token's source view into the source buffer
+	token->source.buffer = lexer->current;
+	token->source.length = wordLength;
 
-					case 't':
-					{
-						memset(bytes + iter, '\t', 1);
-						++iter;
-						index += 2;
-					} break;
+	Lexer_moveBy(lexer, wordLength);
+	return 1;
+}
 
-					case 'v':
-					{
-						memset(bytes + iter, '\v', 1);
-						++iter;
-						index += 2;
-					} break;
+static signed char Lexer_decodeStringLiteral(
+	struct Arena* const arena,
+	const char* const literal,
+	const char* const end,
+	int64_t* const literalLength,
+	union TokenValue* const value)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The arena, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(arena != NULL);
 
-					case '\\':
-					{
-						memset(bytes + iter, '\\', 1);
-						++iter;
-						index += 2;
-					} break;
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The literal and the end, provided to this function, must never ever be null,
+	//        and the literal must never be after the end.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(literal != NULL && end != NULL && literal <= end);
 
-					case '\'':
-					{
-						memset(bytes + iter, '\'', 1);
-						++iter;
-						index += 2;
-					} break;
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The literal length and the value, provided to this function, must never ever
+	//        be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(literalLength != NULL && value != NULL);
 
-					case '\"':
-					{
-						memset(bytes + iter, '\"', 1);
-						++iter;
-						index += 2;
-					} break;
+	// NOTES:
+	//     1. The literal is decoded in one pass: the plain runs between the escapes are found
+	//        with `memchr` and copied at once, and every escape is decoded with the table.
+	//     2. A literal without escapes already is its own bytes, so it gets no storage.
+	const char* quote = (const char*)memchr(literal, '\"', (size_t)(end - literal));
 
-					case '\?':
-					{
-						memset(bytes + iter, '\?', 1);
-						++iter;
-						index += 2;
-					} break;
+	if (quote == NULL)
+	{
+		return 0;
+	}
 
-					default:
-					{
-						index += 1;
-					} break;
-				}
-			}
-			else
+	const char* escape = (const char*)memchr(literal, '\\', (size_t)(quote - literal));
+
+	if (escape == NULL)
+	{
+		*literalLength = quote - literal;
+		value->string.bytes = (const unsigned char*)literal;
+		value->string.length = quote - literal;
+		return 1;
+	}
+
+	// NOTE: the decoded literal is never longer than the rest of the line.
+	unsigned char* bytes = (unsigned char*)Arena_allocate(arena, end - literal);
+	int64_t length = 0;
+	const char* run = literal;
+
+	while (escape != NULL)
+	{
+		// NOTE: a backslash at the end of the line escapes nothing, so the literal is unterminated.
+		if (escape + 1 >= end)
+		{
+			return 0;
+		}
+
+		memcpy(bytes + length, run, (size_t)(escape - run));
+		length += escape - run;
+
+		const unsigned char symbol = (unsigned char)escape[1];
+		bytes[length++] = escapes[symbol] != 0 ? escapes[symbol] : symbol;
+		run = escape + 2;
+
+		// The escaped symbol might have been the found quote
+		if (run > quote)
+		{
+			quote = (const char*)memchr(run, '\"', (size_t)(end - run));
+
+			if (quote == NULL)
 			{
-				bytes[iter++] = literal[index];
-				index += 1;
+				return 0;
 			}
 		}
 
-		struct Token* token = Lexer_createToken();
-		Lexer_setupToken(token, context->count++, TOKEN_LITERAL_STRING, context->location);
+		escape = (const char*)memchr(run, '\\', (size_t)(quote - run));
+	}
 
-		token->value.string.bytes = bytes;
-		token->value.string.length = bytesLength;
+	memcpy(bytes + length, run, (size_t)(quote - run));
+	length += quote - run;
 
-		token->source.buffer = (char*)malloc((literalLength) * sizeof(char));
+	*literalLength = quote - literal;
+	value->string.bytes = bytes;
+	value->string.length = length;
+	return 1;
+}
 
-		// NOTE: using `assert` and not `if`
-		// REASONS:
-		//     1. The memory allocation errors can happen anytime, no matter build
-		//        configuration being debug or release. However, since the compiler
-		//        cannot prevent such bugs, I will leave it as assert. Worst case
-		//        scenario - the compiler crashes, and user re-runs it.
-		//     2. This assert will prevent developers infliced bugs and development
-		//        and debug configuration.
-		assert(token->source.buffer != NULL);
+static signed char Lexer_tryParseLiteral(
+	struct Lexer* const lexer,
+	struct Token* const token)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The lexer, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(lexer != NULL);
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The token, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(token != NULL);
 
-		// Copying identifier name over to the token
-		memcpy(token->source.buffer, literal, literalLength);
+	// Try parse string literal
+	if (*lexer->current == '\"')
+	{
+		const char* literal = lexer->current + 1;
+		int64_t literalLength = 0;
+		union TokenValue value = {0};
+
+		// NOTE: string literals are line-local, so an unterminated one is not a literal.
+		if (!Lexer_decodeStringLiteral(lexer->arena, literal, lexer->end, &literalLength, &value))
+		{
+			return 0;
+		}
+
+		Lexer_setupToken(token, TOKEN_LITERAL_STRING);
+		token->value = value;
+
+		// Pointing the token's source view into the source buffer
+		token->source.buffer = literal;
 		token->source.length = literalLength;
 
-		List_push(tokens, token);
-		Lexer_moveBy(context, literalLength + 2);
+		Lexer_moveBy(lexer, literalLength + 2);
 		return 1;
 	}
 	// Try parse numerical literal
 	else
 	{
-		const char prefix = *context->current;
-		if (!(isdigit(prefix) || prefix == '-' || prefix == '+'))
-			return 0;
+		const char* literal = lexer->current;
+		const char* digits = literal;
 
-		const char* literal = context->current;
-		int64_t literalLength = 1;
-		for (const char* iterator = context->current + 1; isdigit(*iterator) && iterator < context->end; ++iterator, ++literalLength);
+		if (*digits == '-' || *digits == '+')
+		{
+			++digits;
+		}
 
-		if (literalLength <= 0)
+		// NOTE: a sign, that is not followed by a digit, is not a numerical literal.
+		if (digits >= lexer->end || !(scannerClasses[(unsigned char)*digits] & SCANNER_CLASS_DIGIT))
 		{
 			return 0;
 		}
 
+		// NOTE: the literal spans all the identifier symbols after the sign, so the invalid
+		//       digits and suffixes are reported as a part of the literal.
+		const int64_t literalLength = Scanner_skipIdentifier(digits, lexer->end) - literal;
 		int64_t value = 0;
+		const enum LexerLiteralError error = Lexer_decodeIntegerLiteral(literal, literal + literalLength, &value);
 
-		if (sscanf(literal, "%ld", &value) <= 0)
+		if (error != LEXER_LITERAL_ERROR_NONE)
 		{
-			return 0;
+			Lexer_setupToken(token, TOKEN_INVALID);
+			token->value.i64 = (int64_t)error;
+		}
+		else
+		{
+			Lexer_setupToken(token, TOKEN_LITERAL_I64);
+			token->value.i64 = value;
 		}
 
-		struct Token* token = Lexer_createToken();
-		Lexer_setupToken(token, context->count++, TOKEN_LITERAL_I64, context->location);
-
-		token->value.i64 = value;
-
-		token->source.buffer = (char*)malloc((literalLength) * sizeof(char));
-
-		// NOTE: using `assert` and not `if`
-		// REASONS:
-		//     1. The memory allocation errors can happen anytime, no matter build
-		//        configuration being debug or release. However, since the compiler
-		//        cannot prevent such bugs, I will leave it as assert. Worst case
-		//        scenario - the compiler crashes, and user re-runs it.
-		//     2. This assert will prevent developers infliced bugs and development
-		//        and debug configuration.
-		assert(token->source.buffer != NULL);
-
-		// Copying identifier name over to the token
-		memcpy(token->source.buffer, literal, literalLength);
+		// Pointing the token's source view into the source buffer
+		token->source.buffer = literal;
 		token->source.length = literalLength;
 
-		List_push(tokens, token);
-		Lexer_moveBy(context, literalLength);
+		Lexer_moveBy(lexer, literalLength);
 		return 1;
 	}
 
 	return 0;
 }
 
-static signed char Lexer_isWhitespace(
-	const char ch)
+static enum LexerLiteralError Lexer_decodeIntegerLiteral(
+	const char* begin,
+	const char* const end,
+	int64_t* const value)
 {
-	return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r' ? 1 : 0;
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The begin and the end, provided to this function, must never ever be null, and
+	//        the begin must never be after the end.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(begin != NULL && end != NULL && begin <= end);
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The value, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(value != NULL);
+
+	// NOTES:
+	//     1. Decoded forms are decimal `123`, hexadecimal `0x7b`, and binary `0b1111011`,
+	//        optionally signed, with single `_` separators between the digits (`1_000_000`).
+	//     2. The magnitude is accumulated unsigned and checked before every digit, so the
+	//        overflow is detected instead of wrapping. The negative literals may reach the
+	//        magnitude of the `INT64_MIN`.
+	signed char negative = 0;
+
+	if (begin < end && (*begin == '-' || *begin == '+'))
+	{
+		negative = *begin == '-';
+		++begin;
+	}
+
+	uint64_t base = 10;
+
+	if (end - begin > 2 && begin[0] == '0' && (begin[1] == 'x' || begin[1] == 'X'))
+	{
+		base = 16;
+		begin += 2;
+	}
+	else if (end - begin > 2 && begin[0] == '0' && (begin[1] == 'b' || begin[1] == 'B'))
+	{
+		base = 2;
+		begin += 2;
+	}
+
+	// Separators are allowed only between digits
+	if (begin >= end || *begin == '_' || *(end - 1) == '_')
+	{
+		return LEXER_LITERAL_ERROR_MALFORMED;
+	}
+
+	const uint64_t limit = negative ? (uint64_t)INT64_MAX + 1 : (uint64_t)INT64_MAX;
+	uint64_t magnitude = 0;
+	enum LexerLiteralError error = LEXER_LITERAL_ERROR_NONE;
+
+	for (const char* iterator = begin; iterator < end; ++iterator)
+	{
+		uint64_t digit = 0;
+
+		if (*iterator >= '0' && *iterator <= '9')
+		{
+			digit = (uint64_t)(*iterator - '0');
+		}
+		else if (*iterator >= 'a' && *iterator <= 'f')
+		{
+			digit = (uint64_t)(*iterator - 'a') + 10;
+		}
+		else if (*iterator >= 'A' && *iterator <= 'F')
+		{
+			digit = (uint64_t)(*iterator - 'A') + 10;
+		}
+		else if (*iterator == '_' && *(iterator - 1) != '_')
+		{
+			continue;
+		}
+		else
+		{
+			return LEXER_LITERAL_ERROR_MALFORMED;
+		}
+
+		if (digit >= base)
+		{
+			return LEXER_LITERAL_ERROR_MALFORMED;
+		}
+
+		// NOTE: not returning right away, a malformed digit further in the literal is the
+		//       more precise error to report.
+		if (error != LEXER_LITERAL_ERROR_NONE || magnitude > (limit - digit) / base)
+		{
+			error = LEXER_LITERAL_ERROR_OVERFLOW;
+			continue;
+		}
+
+		magnitude = magnitude * base + digit;
+	}
+
+	if (error != LEXER_LITERAL_ERROR_NONE)
+	{
+		return error;
+	}
+
+	*value = negative ? (int64_t)(0 - magnitude) : (int64_t)magnitude;
+	return LEXER_LITERAL_ERROR_NONE;
 }
 
 static void Lexer_skipWhitespace(
-	struct LexerContext* const context)
+	struct Lexer* const lexer)
 {
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The context, provided to this function, must never ever be null.
+	//     1. The lexer, provided to this function, must never ever be null.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(context != NULL);
+	assert(lexer != NULL);
 
-	while (Lexer_isWhitespace(*(context->current)))
-	{
-		Lexer_moveBy(context, 1);
-	}
+	Lexer_moveBy(lexer, Scanner_skipWhitespace(lexer->current, lexer->end) - lexer->current);
 }
 
 /**
@@ -11,6 +11,7 @@
  */
 
 #include <types.h>
+#include <scanner.h>
 #include <lexer.h>
 #include <parser.h>
 #include <validator.h>
@@ -26,6 +27,7 @@
 #	error "TODO: need to add equivalent of sys/stat.h!"
 #else
 #	include <sys/stat.h>
+#	include <unistd.h>
 #endif
 
 static void usage(
@@ -39,6 +41,12 @@ static const char* shift(
 static void flushLogs(
 	struct Queue* const logs);
 
+static signed char streamSource(
+	struct Arena* const arena,
+	struct Source* const source,
+	const char* outputPath,
+	struct Queue* const logs);
+
 int main(
 	int argc,
 	char** argv)
@@ -66,7 +74,10 @@ int main(
 
 	// [STEP 1] (Setup flags and sources).
 	const char* outpuPath = NULL;
-	struct List sources = List_create();
+	const char* cacheDirectory = NULL;
+	signed char isStreamed = 0;
+	int64_t threadsCount = 0;
+	struct List sources = List_create(NULL);
 
 	// [STEP 2] (Parse command-line arguments).
 	while (argc > 0)
@@ -107,6 +118,75 @@ int main(
 
 			outpuPath = flag;
 		}
+		else if (strcmp(flag, "--cache") == 0 || strcmp(flag, "-c") == 0)
+		{
+			if (cacheDirectory != NULL)
+			{
+				fprintf(stderr, "[main]: error: repeating --cache | -c flag!\n");
+				usage(stderr, arg0);
+				exit(1);
+			}
+
+			if (argc <= 0)
+			{
+				fprintf(stderr, "[main]: error: no command-line value providded for flag `%s`!\n", flag);
+				usage(stderr, arg0);
+				exit(1);
+			}
+
+			flag = shift(&argc, &argv);
+
+			if (flag == NULL || strlen(flag) <= 0)
+			{
+				fprintf(stderr, "[main]: error: encountered flag was invalid (null or empty)!\n");
+				usage(stderr, arg0);
+				exit(1);
+			}
+
+			cacheDirectory = flag;
+		}
+		else if (strcmp(flag, "--stream") == 0 || strcmp(flag, "-s") == 0)
+		{
+			if (isStreamed)
+			{
+				fprintf(stderr, "[main]: error: repeating --stream | -s flag!\n");
+				usage(stderr, arg0);
+				exit(1);
+			}
+
+			isStreamed = 1;
+		}
+		else if (strcmp(flag, "--jobs") == 0 || strcmp(flag, "-j") == 0)
+		{
+			if (threadsCount > 0)
+			{
+				fprintf(stderr, "[main]: error: repeating --jobs | -j flag!\n");
+				usage(stderr, arg0);
+				exit(1);
+			}
+
+			if (argc <= 0)
+			{
+				fprintf(stderr, "[main]: error: no command-line value providded for flag `%s`!\n", flag);
+				usage(stderr, arg0);
+				exit(1);
+			}
+
+			flag = shift(&argc, &argv);
+			char* end = NULL;
+
+			if (flag != NULL)
+			{
+				threadsCount = (int64_t)strtoll(flag, &end, 10);
+			}
+
+			if (flag == NULL || end == flag || *end != '\0' || threadsCount <= 0)
+			{
+				fprintf(stderr, "[main]: error: encountered flag was invalid (null or not a positive count)!\n");
+				usage(stderr, arg0);
+				exit(1);
+			}
+		}
 		else if (strcmp(flag, "--help") == 0 || strcmp(flag, "-h") == 0)
 		{
 			usage(stdout, arg0);
@@ -126,28 +206,37 @@ int main(
 		exit(1);
 	}
 
+	// NOTE: the streamed sources are never held as a whole token stream, so there is nothing
+	//       to be cached.
+	if (isStreamed && cacheDirectory != NULL)
+	{
+		fprintf(stderr, "[main]: error: --stream | -s flag cannot be combined with --cache | -c flag!\n");
+		usage(stderr, arg0);
+		exit(1);
+	}
+
+	// NOTE: big sources are lexed and validated on as many threads as there are processors,
+	//       unless the count is provided.
+	if (threadsCount <= 0)
+	{
+		threadsCount = (int64_t)sysconf(_SC_NPROCESSORS_ONLN);
+		threadsCount = threadsCount > 0 ? threadsCount : 1;
+	}
+
 	if (outpuPath == NULL || (outpuPath != NULL && strlen(outpuPath) <= 0))
 	{
 		outpuPath = "target.asm";
 	}
 
 	// Global logs container
-	struct Queue logs = Queue_create();
+	struct Queue logs = Queue_create(NULL);
 
 	// [STEP 4] (Validate source files).
 	int64_t nonExistingFilesCount = 0;
 
-	for (struct LNode* iterator = sources.front; iterator != NULL; iterator = iterator->next)
+	for (int64_t index = 0; index < sources.count; ++index)
 	{
-		// NOTE: using `assert` and not `if`
-		// REASONS:
-		//     1. The data of the iterator node, in the list must never be of value
-		//        null.
-		//     2. This assert will prevent developers infliced bugs and development
-		//        and debug configuration.
-		assert(iterator->data != NULL);
-
-		const char* source = (const char*)iterator->data;
+		const char* source = (const char*)List_at(&sources, index);
 
 		struct stat buffer = {0};
 		signed int exist = stat(source, &buffer);
@@ -183,36 +272,48 @@ int main(
 	//     5. Running the optimizer.
 	//     6. Running the translator.
 	//     7. Print everything in the logs queue and destroy it.
-	//     8. Cleanup tokens and procedures.
+	//     8. Cleanup the compilation unit's arena and the source buffer.
 	// 
 	// NOTES:
 	//     1. Logs queue must be empty.
 	//     2. Sources list must NOT be empty.
 
-	for (struct LNode* sourcesIterator = sources.front; sourcesIterator != NULL; sourcesIterator = sourcesIterator->next)
-	{
-		// NOTE: using `assert` and not `if`
-		// REASONS:
-		//     1. The data of the sources iterator node, in the list must never be
-		//        of value null, since the sources were already checked.
-		//     2. This assert will prevent developers infliced bugs and development
-		//        and debug configuration.
-		assert(sourcesIterator->data != NULL);
+	// Selecting the lexer's scanning kernels for the running CPU once for all sources
+	Scanner_initialize();
 
+	for (int64_t sourcesIndex = 0; sourcesIndex < sources.count; ++sourcesIndex)
+	{
 		// Setup everything here
-		const char* source = (const char*)sourcesIterator->data;
-		struct List tokens = List_create();
-		struct Globals globals = Globals_create();
+		// NOTE: everything, that belongs to this compilation unit (tokens, procedures and
+		//       their containers' elements), is allocated in its arena and is released at once.
+		struct Arena arena = Arena_create();
+		struct Source source = Source_create((const char*)List_at(&sources, sourcesIndex));
+		struct Tokens tokens = Tokens_create(&arena, &source);
+		struct Globals globals = Globals_create(&arena);
 
 		// [STEP 1] (Running the preprocessor).
 		// TODO: run the preprocessor!
 
+		// NOTE: the streamed source runs all the steps below one procedure at a time.
+		if (isStreamed)
+		{
+			if (streamSource(&arena, &source, outpuPath, &logs))
+			{
+				Queue_enqueue(&logs, Log_create("lexer", SEVERITY_SUCCESS, INVALID_LOCATION, "lexer finished successfully!"));
+				Queue_enqueue(&logs, Log_create("parser", SEVERITY_SUCCESS, INVALID_LOCATION, "parser finished successfully!"));
+				Queue_enqueue(&logs, Log_create("validator", SEVERITY_SUCCESS, INVALID_LOCATION, "validator finished successfully!"));
+				Queue_enqueue(&logs, Log_create("translator", SEVERITY_SUCCESS, INVALID_LOCATION, "translator finished successfully!"));
+			}
+
+			goto cleanup;
+		}
+
 		// [STEP 2] (Running the lexer and checking the tokens count).
 
 		// NOTE: in case tokens list will be empty, the lexer will go to cleanup and dump this source file.
 		//       Having said that, there is no need to handle tokens list's count anywhere (maybe apart having)
 		//       some asserts everywhere for bug-catching).
-		if (!Lexer_lexFile(source, &tokens, &logs))
+		if (!Lexer_lexFile(&source, &tokens, cacheDirectory, threadsCount, &logs))
 		{
 			goto cleanup;
 		}
@@ -232,7 +333,6 @@ int main(
 		// TODO: memory must only use numeric integer literal for the size!
 		// TODO: implement with <identifiers> do <block <end>
 		// TODO: procedures and memories are both globals, so create a Global wrapper for a union pf Procedure and Memory
-		// TODO: all globals must be stored in a hash map
 		// TODO: `with` needs to use hash map for the identifiers (i presume)
 		// TODO: add warnings for global things that are not used: procedures, global memories
 		// TODO: must implement check for multiple `main` procedures
@@ -251,7 +351,7 @@ int main(
 		// [STEP 4] (Running the validator and type check globals and control-flow).
 		// TODO:
 		//     1. Refactor ALL log messages.
-		if (!Validator_validateTokens(&globals, &logs))
+		if (!Validator_validateTokens(&globals, threadsCount, &logs))
 		{
 			goto cleanup;
 		}
@@ -279,24 +379,11 @@ cleanup:
 		flushLogs(&logs);
 		Queue_destroy(&logs);
 
-		// [STEP 8] (Cleanup tokens and globals).
-		Globals_destroy(&globals);
+		// [STEP 8] (Cleanup the compilation unit's arena and the source buffer).
+		Arena_destroy(&arena);
 
-		for (struct LNode* tokensIterator = tokens.front; tokensIterator != NULL; tokensIterator = tokensIterator->next)
-		{
-			// NOTE: using `assert` and not `if`
-			// REASONS:
-			//     1. The data of the tokens iterator node, in the list must never be
-			//        of value null.
-			//     2. This assert will prevent developers infliced bugs and development
-			//        and debug configuration.
-			assert(tokensIterator->data != NULL);
-
-			struct Token* token = (struct Token*)tokensIterator->data;
-			Token_destroy(token);
-		}
-
-		List_destroy(&tokens);
+		// NOTE: the source must outlive the tokens, since their text points into its buffer.
+		Source_destroy(&source);
 	}
 
 	List_destroy(&sources);
@@ -312,6 +399,9 @@ static void usage(
 		"Usage: %s [Options] sources...\n"
 		"Options:\n"
 		"    [ --output       | -o  ] <path>         Set output path for the target\n"
+		"    [ --cache        | -c  ] <directory>    Reuse tokens of unchanged sources, cached in the directory\n"
+		"    [ --stream       | -s  ]                Compile one procedure at a time, bounding the tokens memory\n"
+		"    [ --jobs         | -j  ] <count>        Lex and validate big sources on up to count threads\n"
 		"    [ --help         | -h  ]                Print usage message\n",
 		argv0);
 }
@@ -350,3 +440,163 @@ static void flushLogs(
 		Log_destroy(log);
 	}
 }
+
+static signed char streamSource(
+	struct Arena* const arena,
+	struct Source* const source,
+	const char* outputPath,
+	struct Queue* const logs)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The arena, the source, the output path, and the logs, provided to this function,
+	//        must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(arena != NULL && source != NULL && outputPath != NULL && logs != NULL);
+
+	// STEPS:
+	//     1. Pull the signatures of all procedures (their tokens up to the `do`, and their
+	//        closing `end`), skipping the bodies, and parse them into the procedures'
+	//        declarations, so every procedure can be called before it is defined.
+	//     2. Pull the source again, and parse, validate, and translate every procedure as soon
+	//        as its closing `end` is pulled, dropping its tokens and instructions afterwards.
+	// 
+	// NOTES:
+	//     1. The memory is bounded by the signatures and the biggest procedure, instead of the
+	//        whole token stream. Only the interned symbols and the pooled string literals grow
+	//        with the source.
+	//     2. The procedures are closed by counting the `do` blocks, the parser reports any
+	//        mismatched ones.
+	//     3. The diagnostics stop at the first failed procedure, the same way the parser and
+	//        the validator stop on the whole token stream, but invalid tokens are only reported
+	//        up to it too.
+	struct Tokens tokens = Tokens_create(arena, source);
+	struct Globals globals = Globals_create(arena);
+	struct Lexer lexer = {0};
+
+	// NOTE: every procedure's decoded string literals and instructions are allocated in its
+	//       own arena, that is released as soon as the procedure is translated.
+	struct Arena procedureArena = Arena_create();
+
+	// [STEP 1] (Pull the signatures of all procedures).
+	if (!Lexer_open(&lexer, &procedureArena, source, logs))
+	{
+		return 0;
+	}
+
+	signed char valid = 1;
+	int64_t depth = 0; // of the `do` blocks, that are not closed yet
+
+	for (struct Token token = {0}; Lexer_next(&lexer, &token);)
+	{
+		const signed char isSignature = depth <= 0 || (depth == 1 && token.kind == TOKEN_KEYWORD_END);
+
+		if (token.kind == TOKEN_KEYWORD_DO)
+		{
+			++depth;
+		}
+		else if (token.kind == TOKEN_KEYWORD_END && depth > 0)
+		{
+			--depth;
+		}
+
+		if (isSignature)
+		{
+			valid = Lexer_pushToken(&tokens, &token, logs) && valid;
+
+			// A misplaced string literal must keep its bytes, until the parser reports it
+			if (token.kind == TOKEN_LITERAL_STRING)
+			{
+				Arena_adopt(arena, &procedureArena);
+			}
+		}
+
+		if (depth <= 0)
+		{
+			Arena_destroy(&procedureArena);
+		}
+	}
+
+	if (tokens.count <= 0)
+	{
+		Queue_enqueue(logs, Log_create("lexer", SEVERITY_ERROR, INVALID_LOCATION, "file `%s` was empty of compilable source which is forbidden!", source->file));
+
+#if HIVEC_DEBUG
+		Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+			(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+			"locator of the log above this meesage."));
+#endif
+
+		valid = 0;
+	}
+
+	if (!valid || !Parser_parseTokens(&globals, &tokens, logs))
+	{
+		Arena_destroy(&procedureArena);
+		return 0;
+	}
+
+	// [STEP 2] (Pull the source again, and parse, validate, and translate every procedure).
+	struct Translator translator = {0};
+
+	if (!Translator_open(&translator, outputPath, logs))
+	{
+		Arena_destroy(&procedureArena);
+		return 0;
+	}
+
+	const int64_t signaturesCount = tokens.count;
+	(void)Lexer_open(&lexer, &procedureArena, source, logs);
+	depth = 0;
+
+	for (struct Token token = {0}; Lexer_next(&lexer, &token);)
+	{
+		// NOTE: not stopping at the first invalid token, so all of the procedure's ones
+		//       are reported.
+		valid = Lexer_pushToken(&tokens, &token, logs) && valid;
+
+		if (token.kind == TOKEN_KEYWORD_DO)
+		{
+			++depth;
+		}
+		else if (token.kind == TOKEN_KEYWORD_END && --depth <= 0)
+		{
+			struct Procedure* procedure = valid ? Parser_parseProcedureTokens(&globals, &tokens, signaturesCount, &procedureArena, logs) : NULL;
+			valid = procedure != NULL && Validator_validateProcedureTokens(&globals, procedure, logs);
+
+			if (valid)
+			{
+				Translator_translateProcedure(&translator, &globals, procedure);
+				Translator_translateStringLiterals(&translator, &globals);
+			}
+
+			if (procedure != NULL)
+			{
+				procedure->instructions = NULL;
+				procedure->instructionsCount = 0;
+			}
+
+			Tokens_truncate(&tokens, signaturesCount);
+			Arena_destroy(&procedureArena);
+			depth = 0;
+
+			if (!valid)
+			{
+				break;
+			}
+		}
+	}
+
+	Arena_destroy(&procedureArena);
+	Translator_close(&translator);
+
+	// NOTE: the output is only ever left behind for a valid source, the same way the translator
+	//       only writes it for a valid token stream.
+	if (!valid)
+	{
+		(void)remove(outputPath);
+	}
+
+	return valid;
+}
@@ -25,12 +25,17 @@
 
 struct ParserContext
 {
-	struct LNode* iterator;
+	struct Tokens* tokens;
+	int64_t token;
+	int64_t* scopes; // stack of the tokens, that opened the not yet closed blocks
+	int64_t scopesCount;
+	int64_t* instructions; // index of the first instruction, lowered from every body's token
+	int64_t first; // token, that the instructions are indexed from
 };
 
 static void Parser_collectStringLiterals(
-	struct List* const stringLiterals,
-	const struct List* const tokens,
+	struct Globals* const globals,
+	const int64_t begin,
 	struct Queue* const logs);
 
 static signed char Parser_parseProcedure(
@@ -38,13 +43,26 @@ static signed char Parser_parseProcedure(
 	struct ParserContext* const context,
 	struct Queue* const logs);
 
-static signed char Parser_crossReference(
-	struct Globals* const globals,
-	struct Queue* const logs);
+static int64_t Parser_countInstructions(
+	const struct Tokens* const tokens,
+	const int64_t token);
+
+static void Parser_lowerProcedure(
+	const struct Globals* const globals,
+	struct Arena* const arena,
+	struct Procedure* const procedure,
+	struct ParserContext* const context);
+
+static void Parser_resolveCalls(
+	const struct Globals* const globals);
+
+static void Parser_resolveProcedureCalls(
+	const struct Globals* const globals,
+	struct Procedure* const procedure);
 
 signed char Parser_parseTokens(
 	struct Globals* const globals,
-	const struct List* const tokens,
+	struct Tokens* const tokens,
 	struct Queue* const logs)
 {
 	// NOTE: using `assert` and not `if`
@@ -75,78 +93,62 @@ signed char Parser_parseTokens(
 	//     process.
 	assert(tokens->count > 0);
 
-	Parser_collectStringLiterals(&globals->stringLiterals, tokens, logs);
-	signed char parsedMain = 0;
+	globals->tokens = tokens;
+	Parser_collectStringLiterals(globals, 0, logs);
 
-	for (struct LNode* iterator = tokens->front; iterator != NULL;)
-	{
-		// NOTE: using `assert` and not `if`
-		// REASONS:
-		//     1. The iterator's data, in the list must never be of value null.
-		//     2. This assert will prevent developers infliced bugs and development
-		//        and debug configuration.
-		assert(iterator->data != NULL);
-
-		struct Token* token = (struct Token*)iterator->data;
+	// NOTE: the nesting of blocks can never be deeper than the tokens count, so the scopes
+	//       stack is allocated once for all the procedures.
+	struct ParserContext context = {0};
+	context.tokens = tokens;
+	context.token = 0;
+	context.scopes = (int64_t*)Arena_allocate(globals->arena, tokens->count * (int64_t)sizeof(int64_t));
+	context.scopesCount = 0;
+	context.instructions = (int64_t*)Arena_allocate(globals->arena, (tokens->count + 1) * (int64_t)sizeof(int64_t));
+	context.first = 0;
 
-		switch (token->kind)
+	for (int64_t token = 0; token < tokens->count;)
+	{
+		switch (tokens->kinds[token])
 		{
 			case TOKEN_KEYWORD_PROCEDURE:
 			{
-				struct ParserContext context = (struct ParserContext) { .iterator = iterator };
-				struct Procedure* procedure = Procedure_create();
+				context.token = token;
+				struct Procedure* procedure = Procedure_create(globals->arena);
 
 				if (!Parser_parseProcedure(procedure, &context, logs))
 				{
 					return 0;
 				}
 
-				if (procedure->name->kind == TOKEN_KEYWORD_MAIN)
-				{
-					parsedMain = 1;
-				}
+				// NOTE: the procedures are hashed by their names, so the redefinitions are found
+				//       without walking all the procedures, defined before.
+				struct Procedure* existing = Globals_define(globals, procedure);
 
-				for (struct LNode* proceduresIterator = globals->procedures.front; proceduresIterator != NULL; proceduresIterator = proceduresIterator->next)
+				if (existing != NULL)
 				{
-					// NOTE: using `assert` and not `if`
-					// REASONS:
-					//     1. The procedures iterator's data, in the list must never be of value
-					//        null.
-					//     2. This assert will prevent developers infliced bugs and development
-					//        and debug configuration.
-					assert(proceduresIterator->data != NULL);
-
-					struct Procedure* existing = (struct Procedure*)proceduresIterator->data;
-
-					if (procedure->name->source.length == existing->name->source.length
-					 && strncmp(procedure->name->source.buffer, existing->name->source.buffer, procedure->name->source.length) == 0)
-					{
-						Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, existing->name->location, "encountered an already defined procedure `%.*s`!",
-							(signed int)existing->name->source.length, existing->name->source.buffer));
+					Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, Tokens_location(tokens, existing->name), "encountered an already defined procedure `%.*s`!",
+						(signed int)tokens->lengths[existing->name], Tokens_source(tokens, existing->name)));
 
 #if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
+					Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+						(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+						"locator of the log above this meesage."));
 #endif
 
-						return 0;
-					}
+					return 0;
 				}
 
-				List_push(&globals->procedures, procedure);
-
-				iterator = context.iterator;
+				// The jump targets are known once the procedure is parsed, so it is lowered
+				// right away
+				Parser_lowerProcedure(globals, globals->arena, procedure, &context);
 
-				if (iterator != NULL)
-				{
-					iterator = iterator->next;
-				}
+				// Continuing after the procedure's closing `end`
+				token = context.token + 1;
 			} break;
 
 			default:
 			{
-				Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, token->location, "encountered an invalid global token `%.*s`!", (signed int)token->source.length, token->source.buffer));
+				Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, Tokens_location(tokens, token), "encountered an invalid global token `%.*s`!", (signed int)tokens->lengths[token], Tokens_source(tokens, token)));
 
 #if HIVEC_DEBUG
 				Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
@@ -159,7 +161,7 @@ signed char Parser_parseTokens(
 		}
 	}
 
-	if (!parsedMain)
+	if (globals->main == NULL)
 	{
 		Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, INVALID_LOCATION, "missing `main` procedure!"));
 
@@ -172,29 +174,139 @@ signed char Parser_parseTokens(
 		return 0;
 	}
 
-	return Parser_crossReference(globals, logs);
+	// NOTES:
+	//     1. Since procedures count is validated here, it is not required to be logged in
+	//        any following subprocess. However, I advice to place asserts in all those
+	//        places to catch any possible developer-inflicted bugs.
+	//     2. In case the tokens list is empty (the source was empty of compilable code),
+	//        all the following processes must be skipped and all resources deallocated.
+	if (globals->procedures.count <= 0)
+	{
+		Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, INVALID_LOCATION, "failed to parse any procedures!"));
+
+#if HIVEC_DEBUG
+		Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+			(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+			"locator of the log above this meesage."));
+#endif
+
+		return 0;
+	}
+
+	Parser_resolveCalls(globals);
+	return 1;
+}
+
+struct Procedure* Parser_parseProcedureTokens(
+	struct Globals* const globals,
+	struct Tokens* const tokens,
+	const int64_t token,
+	struct Arena* const arena,
+	struct Queue* const logs)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The globals, provided to this function, must never ever be null, and must be
+	//        parsed from the same tokens, since their signatures are looked up in them.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(globals != NULL && globals->tokens == tokens);
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The tokens, provided to this function, must never ever be null, and the
+	//        procedure's first token must be one of them.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(tokens != NULL && token >= 0 && token < tokens->count);
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The arena and the logs, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(arena != NULL && logs != NULL);
+
+	// STEPS:
+	//     1. Parse the procedure, that spans the rest of the tokens.
+	//     2. Find its declaration, parsed from the signatures (see `Parser_parseTokens`).
+	//     3. Pool its string literals, lower its body into the declaration, and resolve its
+	//        calls, since all procedures are already declared.
+
+	// [STEP 1] (Parse the procedure, that spans the rest of the tokens).
+	struct ParserContext context = {0};
+	context.tokens = tokens;
+	context.token = token;
+	// NOTE: the procedure is the last one in the tokens, so its scopes and instructions are
+	//       only allocated for its own tokens, and not for the signatures before it.
+	context.scopes = (int64_t*)Arena_allocate(arena, (tokens->count - token) * (int64_t)sizeof(int64_t));
+	context.scopesCount = 0;
+	context.instructions = (int64_t*)Arena_allocate(arena, (tokens->count - token + 1) * (int64_t)sizeof(int64_t));
+	context.first = token;
+
+	struct Procedure* procedure = Procedure_create(arena);
+
+	if (!Parser_parseProcedure(procedure, &context, logs))
+	{
+		return NULL;
+	}
+
+	if (context.token + 1 < tokens->count)
+	{
+		const int64_t trailing = context.token + 1;
+		Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, Tokens_location(tokens, trailing), "encountered an invalid global token `%.*s`!", (signed int)tokens->lengths[trailing], Tokens_source(tokens, trailing)));
+
+#if HIVEC_DEBUG
+		Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+			(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+			"locator of the log above this meesage."));
+#endif
+
+		return NULL;
+	}
+
+	// [STEP 2] (Find its declaration).
+	struct Procedure* declaration = Globals_find(globals, tokens->symbolIds[procedure->name]);
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. Every procedure is declared from the signatures, before its body is parsed.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(declaration != NULL && tokens->offsets[declaration->name] == tokens->offsets[procedure->name]);
+
+	// [STEP 3] (Pool its string literals, lower its body into the declaration).
+	// NOTE: the declaration keeps its own name and types, since they belong to the
+	//       signatures, which outlive the procedure's tokens.
+	Parser_collectStringLiterals(globals, token, logs);
+	Parser_lowerProcedure(globals, arena, procedure, &context);
+	declaration->body = procedure->body;
+	declaration->instructions = procedure->instructions;
+	declaration->instructionsCount = procedure->instructionsCount;
+	Parser_resolveProcedureCalls(globals, declaration);
+	return declaration;
 }
 
 static void Parser_collectStringLiterals(
-	struct List* const stringLiterals,
-	const struct List* const tokens,
+	struct Globals* const globals,
+	const int64_t begin,
 	struct Queue* const logs)
 {
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The string literls list, provided to this function, must never
-	//        ever be null.
+	//     1. The globals, provided to this function, must never ever be null.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(stringLiterals != NULL);
+	assert(globals != NULL);
 
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The tokens list, provided to this function, must never ever be
-	//        null.
+	//     1. The tokens stream of the globals must never ever be null.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(tokens != NULL);
+	assert(globals->tokens != NULL);
+
+	const struct Tokens* tokens = globals->tokens;
 
 	if (tokens->count <= 0)
 	{
@@ -210,47 +322,15 @@ static void Parser_collectStringLiterals(
 	//        and debug configuration.
 	assert(logs != NULL);
 
-	for (struct LNode* iterator = tokens->front; iterator != NULL; iterator = iterator->next)
+	for (int64_t token = begin; token < tokens->count; ++token)
 	{
-		// NOTE: using `assert` and not `if`
-		// REASONS:
-		//     1. The iterator's data, in the list must never be of value null.
-		//     2. This assert will prevent developers infliced bugs and development
-		//        and debug configuration.
-		assert(iterator->data != NULL);
-
-		struct Token* token = (struct Token*)iterator->data;
-
-		switch (token->kind)
+		switch (tokens->kinds[token])
 		{
 			case TOKEN_LITERAL_STRING:
 			{
-				signed char stringLiteralAlreadyExists = 0;
-
-				for (struct LNode* stringLiteralsIterator = stringLiterals->front; stringLiteralsIterator != NULL; stringLiteralsIterator = stringLiteralsIterator->next)
-				{
-					// NOTE: using `assert` and not `if`
-					// REASONS:
-					//     1. The string literal's iterator's data, in the list must never be
-					//        of value null.
-					//     2. This assert will prevent developers infliced bugs and development
-					//        and debug configuration.
-					assert(stringLiteralsIterator->data != NULL);
-
-					struct Token* stringLiteral = (struct Token*)stringLiteralsIterator->data;
-
-					if (token->source.length == stringLiteral->source.length
-					 && strncmp(token->source.buffer, stringLiteral->source.buffer, token->source.length) == 0)
-					{
-						stringLiteralAlreadyExists = 1;
-						break;
-					}
-				}
-
-				if (!stringLiteralAlreadyExists)
-				{
-					List_push(stringLiterals, token);
-				}
+				// NOTE: the pool is keyed by the decoded bytes, so every spelling of the same
+				//       string literal ends up in the same data.
+				(void)Globals_poolString(globals, token);
 			} break;
 
 			default:
@@ -281,11 +361,11 @@ static signed char Parser_parseProcedure(
 
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The context's iterator, provided to this function, must never ever
-	//        be null.
+	//     1. The context's current token, provided to this function, must always
+	//        be a valid token id.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(context->iterator != NULL);
+	assert(context->token >= 0 && context->token < context->tokens->count);
 
 	// NOTE: using `assert` and not `if`
 	// REASONS:
@@ -300,27 +380,21 @@ static signed char Parser_parseProcedure(
 	//     2. Validate that the token, following the `procedure` token, is an identifier
 	//        token.
 	//     3. Try to collect type specifiers until reaching `do` token.
-	//     4. Parse the body of a procedure.
+	//     4. Parse the body of a procedure, linking its blocks.
 	// 
 	// NOTES:
 	//     1. The procedure's body CAN contain invalid tokens. The tokens will be validated
 	//        by the validator later.
 
 	// [STEP 1] (Validate that current token kind is `procedure`).
-	struct Token* token = (struct Token*)context->iterator->data; // Iterator, at this point, should never be NULL!
+	struct Tokens* tokens = context->tokens;
+	int64_t token = context->token;
 
-	// NOTE: using `assert` and not `if`
-	// REASONS:
-	//     1. The token in iterator's node must never ever be null.
-	//     2. This assert will prevent developers infliced bugs and development
-	//        and debug configuration.
-	assert(token != NULL);
-
-	if (token->kind != TOKEN_KEYWORD_PROCEDURE) 
+	if (tokens->kinds[token] != TOKEN_KEYWORD_PROCEDURE) 
 	{
-		if (token->kind == TOKEN_INVALID)
+		if (tokens->kinds[token] == TOKEN_INVALID)
 		{
-			Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, token->location, "encountered an invalid token `%.*s`!", (signed int)token->source.length, token->source.buffer));
+			Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, Tokens_location(tokens, token), "encountered an invalid token `%.*s`!", (signed int)tokens->lengths[token], Tokens_source(tokens, token)));
 
 #if HIVEC_DEBUG
 			Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
@@ -332,7 +406,7 @@ static signed char Parser_parseProcedure(
 		}
 		else
 		{
-			Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, token->location, "expected a `procedure`, `unsafe`, or `inline` keyword, but found `%.*s`!", (signed int)token->source.length, token->source.buffer));
+			Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, Tokens_location(tokens, token), "expected a `procedure`, `unsafe`, or `inline` keyword, but found `%.*s`!", (signed int)tokens->lengths[token], Tokens_source(tokens, token)));
 
 #if HIVEC_DEBUG
 			Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
@@ -344,11 +418,11 @@ static signed char Parser_parseProcedure(
 		}
 	}
 
-	if (token->kind == TOKEN_KEYWORD_PROCEDURE)
+	if (tokens->kinds[token] == TOKEN_KEYWORD_PROCEDURE)
 	{
-		if (context->iterator->next == NULL)
+		if (context->token + 1 >= tokens->count)
 		{
-			Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, token->location, "missing an identifier token after the `procedure` keyword!"));
+			Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, Tokens_location(tokens, token), "missing an identifier token after the `procedure` keyword!"));
 
 #if HIVEC_DEBUG
 			Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
@@ -359,19 +433,11 @@ static signed char Parser_parseProcedure(
 			return 0;
 		}
 
-		context->iterator = context->iterator->next;
-		token = (struct Token*)context->iterator->data;
-
-		// NOTE: using `assert` and not `if`
-		// REASONS:
-		//     1. The token in iterator's node must never ever be null.
-		//     2. This assert will prevent developers infliced bugs and development
-		//        and debug configuration.
-		assert(token != NULL);
+		token = ++context->token;
 	}
 	else
 	{
-		Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, token->location, "encountered an nivalid token `%.*s` instead of the `procedure` keyword!", (signed int)token->source.length, token->source.buffer));
+		Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, Tokens_location(tokens, token), "encountered an nivalid token `%.*s` instead of the `procedure` keyword!", (signed int)tokens->lengths[token], Tokens_source(tokens, token)));
 
 #if HIVEC_DEBUG
 		Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
@@ -385,12 +451,12 @@ static signed char Parser_parseProcedure(
 	// [STEP 2] (Validate that the token, following the `procedure` token, is an identifier
 	//           token).
 
-	if (token->kind != TOKEN_IDENTIFIER
-	 && token->kind != TOKEN_KEYWORD_MAIN) 
+	if (tokens->kinds[token] != TOKEN_IDENTIFIER
+	 && tokens->kinds[token] != TOKEN_KEYWORD_MAIN) 
 	{
-		if (token->kind == TOKEN_INVALID)
+		if (tokens->kinds[token] == TOKEN_INVALID)
 		{
-			Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, token->location, "encountered an invalid token `%.*s`!", (signed int)token->source.length, token->source.buffer));
+			Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, Tokens_location(tokens, token), "encountered an invalid token `%.*s`!", (signed int)tokens->lengths[token], Tokens_source(tokens, token)));
 
 #if HIVEC_DEBUG
 			Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
@@ -402,7 +468,7 @@ static signed char Parser_parseProcedure(
 		}
 		else
 		{
-			Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, token->location, "encountered an invalid token for procedure's name: `%.*s`!", (signed int)token->source.length, token->source.buffer));
+			Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, Tokens_location(tokens, token), "encountered an invalid token for procedure's name: `%.*s`!", (signed int)tokens->lengths[token], Tokens_source(tokens, token)));
 
 #if HIVEC_DEBUG
 			Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
@@ -415,12 +481,12 @@ static signed char Parser_parseProcedure(
 	}
 
 	procedure->name = token;
-	procedure->isMain = token->kind == TOKEN_KEYWORD_MAIN;
+	procedure->isMain = tokens->kinds[token] == TOKEN_KEYWORD_MAIN;
 
 	// [STEP 3] (Try to collect type specifiers until reaching `do` token).
-	if (context->iterator->next == NULL)
+	if (context->token + 1 >= tokens->count)
 	{
-		Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, token->location, "expected a `do`, `require`, or `return` keyword to follow the procedure's name!"));
+		Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, Tokens_location(tokens, token), "expected a `do`, `require`, or `return` keyword to follow the procedure's name!"));
 
 #if HIVEC_DEBUG
 		Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
@@ -431,43 +497,30 @@ static signed char Parser_parseProcedure(
 		return 0;
 	}
 
-	context->iterator = context->iterator->next;
-	token = (struct Token*)context->iterator->data; // Iterator, at this point, should never be NULL!
-
-	// NOTE: using `assert` and not `if`
-	// REASONS:
-	//     1. The token in iterator's node must never ever be null.
-	//     2. This assert will prevent developers infliced bugs and development
-	//        and debug configuration.
-	assert(token != NULL);
+	token = ++context->token;
 
-	if (token->kind == TOKEN_KEYWORD_REQUIRE)
+	if (tokens->kinds[token] == TOKEN_KEYWORD_REQUIRE)
 	{
-		for (context->iterator = context->iterator->next; context->iterator != NULL;)
-		{
-			// NOTE: using `assert` and not `if`
-			// REASONS:
-			//     1. The iterator's data, in the list must never be of value null.
-			//     2. This assert will prevent developers infliced bugs and development
-			//        and debug configuration.
-			assert(context->iterator->data != NULL);
+		procedure->requiredTypes.begin = context->token + 1;
+		procedure->requiredTypes.end = context->token + 1;
 
-			token = (struct Token*)context->iterator->data;
+		for (++context->token; context->token < tokens->count;)
+		{
+			token = context->token;
 
-			if (token->kind == TOKEN_KEYWORD_I64
-			 || token->kind == TOKEN_KEYWORD_P64)
+			if (tokens->kinds[token] == TOKEN_KEYWORD_I64
+			 || tokens->kinds[token] == TOKEN_KEYWORD_P64)
 			{
-				List_push(&procedure->requiredTypes, token);
-				context->iterator = context->iterator->next;
+				procedure->requiredTypes.end = ++context->token;
 			}
-			else if (token->kind == TOKEN_KEYWORD_RETURN
-				  || token->kind == TOKEN_KEYWORD_DO)
+			else if (tokens->kinds[token] == TOKEN_KEYWORD_RETURN
+				  || tokens->kinds[token] == TOKEN_KEYWORD_DO)
 			{
 				break;
 			}
 			else
 			{
-				Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, token->location, "encountered invalid keyword `%.*s` in the place of `require` types specifiers!", (signed int)token->source.length, token->source.buffer));
+				Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, Tokens_location(tokens, token), "encountered invalid keyword `%.*s` in the place of `require` types specifiers!", (signed int)tokens->lengths[token], Tokens_source(tokens, token)));
 
 #if HIVEC_DEBUG
 				Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
@@ -480,32 +533,27 @@ static signed char Parser_parseProcedure(
 		}
 	}
 
-	if (token->kind == TOKEN_KEYWORD_RETURN)
+	if (tokens->kinds[token] == TOKEN_KEYWORD_RETURN)
 	{
-		for (context->iterator = context->iterator->next; context->iterator != NULL;)
-		{
-			// NOTE: using `assert` and not `if`
-			// REASONS:
-			//     1. The iterator's data, in the list must never be of value null.
-			//     2. This assert will prevent developers infliced bugs and development
-			//        and debug configuration.
-			assert(context->iterator->data != NULL);
+		procedure->returnedTypes.begin = context->token + 1;
+		procedure->returnedTypes.end = context->token + 1;
 
-			token = (struct Token*)context->iterator->data;
+		for (++context->token; context->token < tokens->count;)
+		{
+			token = context->token;
 
-			if (token->kind == TOKEN_KEYWORD_I64
-			 || token->kind == TOKEN_KEYWORD_P64)
+			if (tokens->kinds[token] == TOKEN_KEYWORD_I64
+			 || tokens->kinds[token] == TOKEN_KEYWORD_P64)
 			{
-				List_push(&procedure->returnedTypes, token);
-				context->iterator = context->iterator->next;
+				procedure->returnedTypes.end = ++context->token;
 			}
-			else if (token->kind == TOKEN_KEYWORD_DO)
+			else if (tokens->kinds[token] == TOKEN_KEYWORD_DO)
 			{
 				break;
 			}
 			else
 			{
-				Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, token->location, "encountered invalid keyword `%.*s` in the place of `return` types specifiers!", (signed int)token->source.length, token->source.buffer));
+				Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, Tokens_location(tokens, token), "encountered invalid keyword `%.*s` in the place of `return` types specifiers!", (signed int)tokens->lengths[token], Tokens_source(tokens, token)));
 
 #if HIVEC_DEBUG
 				Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
@@ -518,14 +566,12 @@ static signed char Parser_parseProcedure(
 		}
 	}
 
-	// [STEP 4] (Parse the body of a procedure).
-	if (token->kind == TOKEN_KEYWORD_DO)
+	// [STEP 4] (Parse the body of a procedure, linking its blocks).
+	if (tokens->kinds[token] == TOKEN_KEYWORD_DO)
 	{
-		struct Stack stack = Stack_create();
-
-		if (context->iterator->next == NULL)
+		if (context->token + 1 >= tokens->count)
 		{
-			Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, token->location, "failed to parse procedure's body!"));
+			Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, Tokens_location(tokens, token), "failed to parse procedure's body!"));
 
 #if HIVEC_DEBUG
 			Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
@@ -533,27 +579,20 @@ static signed char Parser_parseProcedure(
 				"locator of the log above this meesage."));
 #endif
 
-			Stack_destroy(&stack);
 			return 0;
 		}
 
-		Stack_push(&stack, token); // Pushing `do` onto the stack for scoping.
-		context->iterator = context->iterator->next;
+		context->scopesCount = 0;
+		context->scopes[context->scopesCount++] = token; // Pushing `do` onto the stack for scoping.
+		procedure->body.begin = context->token + 1;
 
-		for (; context->iterator != NULL;)
+		for (++context->token; context->token < tokens->count; ++context->token)
 		{
-			// NOTE: using `assert` and not `if`
-			// REASONS:
-			//     1. The iterator's data, in the list must never be of value null.
-			//     2. This assert will prevent developers infliced bugs and development
-			//        and debug configuration.
-			assert(context->iterator->data != NULL);
-
-			token = (struct Token*)context->iterator->data;
+			token = context->token;
 
-			if (token->kind == TOKEN_INVALID)
+			if (tokens->kinds[token] == TOKEN_INVALID)
 			{
-				Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, token->location, "encountered an invalid token `%.*s`!", (signed int)token->source.length, token->source.buffer));
+				Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, Tokens_location(tokens, token), "encountered an invalid token `%.*s`!", (signed int)tokens->lengths[token], Tokens_source(tokens, token)));
 
 #if HIVEC_DEBUG
 				Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
@@ -561,25 +600,26 @@ static signed char Parser_parseProcedure(
 					"locator of the log above this meesage."));
 #endif
 
-				Stack_destroy(&stack);
 				return 0;
 			}
 
-			switch (token->kind)
+			// NOTE: the block structure is resolved right here, the procedure's `do` stays at the
+			//       bottom of the scopes stack, so a single scope means, that no block is open.
+			switch (tokens->kinds[token])
 			{
-				case TOKEN_KEYWORD_DO:
+				case TOKEN_KEYWORD_IF:
+				case TOKEN_KEYWORD_WHILE:
 				{
-					Stack_push(&stack, token);
-					List_push(&procedure->body, token);
-				} break;
+					const int64_t peeked = context->scopes[context->scopesCount - 1];
 
-				case TOKEN_KEYWORD_END:
-				{
-					if (stack.count <= 0)
+					if (context->scopesCount > 1
+					 && (tokens->kinds[peeked] == TOKEN_KEYWORD_IF
+					  || tokens->kinds[peeked] == TOKEN_KEYWORD_WHILE))
 					{
 						// TODO: after implementing `with` remove [UNIMPLEMENTED mark for the `with ... ` sequence.
-						Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, token->location, "`%.*s` keyword must follow `if <condition> do <block>`, `if <condition> do <block> else <block>`, `while <condition> do <block>`, or `[UNIMPLEMENTED] with <identifiers> do <block>` sequences!",
-							(signed int)token->source.length, token->source.buffer));
+						Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, Tokens_location(tokens, peeked), "encountered an invalid keyword `%.*s`, following the `%.*s` keyword!",
+							(signed int)tokens->lengths[token], Tokens_source(tokens, token),
+							(signed int)tokens->lengths[peeked], Tokens_source(tokens, peeked)));
 
 #if HIVEC_DEBUG
 						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
@@ -587,201 +627,18 @@ static signed char Parser_parseProcedure(
 							"locator of the log above this meesage."));
 #endif
 
-						Stack_destroy(&stack);
 						return 0;
 					}
 
-					Stack_pop(&stack);
-
-					if (stack.count <= 0)
-					{
-						Stack_destroy(&stack);
-						return 1;
-					}
-					else
-					{
-						List_push(&procedure->body, token);
-					}
-				} break;
-
-				case TOKEN_KEYWORD_PROCEDURE:
-				case TOKEN_KEYWORD_REQUIRE:
-				case TOKEN_KEYWORD_RETURN:
-				case TOKEN_KEYWORD_I64:
-				case TOKEN_KEYWORD_P64:
-				{
-					Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, token->location, "encountered invalid token `%.*s` in procedure's body!",
-						(signed int)token->source.length, token->source.buffer));
-
-#if HIVEC_DEBUG
-					Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-						(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-						"locator of the log above this meesage."));
-#endif
-
-					Stack_destroy(&stack);
-					return 0;
-				} break;
-
-				default:
-				{
-					List_push(&procedure->body, token);
-				} break;
-			}
-
-			context->iterator = context->iterator->next;
-		}
-
-		if (stack.count > 0)
-		{
-			struct Token* unhandled = NULL;
-
-			while ((unhandled = Stack_pop(&stack)) != NULL)
-			{
-				Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, unhandled->location, "encountered an unhandled token `%.*s`!", (signed int)unhandled->source.length, unhandled->source.buffer));
-
-#if HIVEC_DEBUG
-				Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-					(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-					"locator of the log above this meesage."));
-#endif
-			}
-
-			Stack_destroy(&stack);
-			return 0;
-		}
-
-		Stack_destroy(&stack);
-	}
-	else
-	{
-		Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, token->location, "encountered an invalid keyword `%.*s` instead of `do` keyword after procedure's definition!", (signed int)token->source.length, token->source.buffer));
-
-#if HIVEC_DEBUG
-		Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-			(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-			"locator of the log above this meesage."));
-#endif
-
-		return 0;
-	}
-
-	return 1;
-}
-
-static signed char Parser_crossReference(
-	struct Globals* const globals,
-	struct Queue* const logs)
-{
-	// NOTE: using `assert` and not `if`
-	// REASONS:
-	//     1. The globals, provided to this function, must never ever be null.
-	//     2. This assert will prevent developers infliced bugs and development
-	//        and debug configuration.
-	assert(globals != NULL);
-
-	// NOTE: using `assert` and not `if`
-	// REASONS:
-	//     1. The logs, provided to this function, must never ever be null.
-	//     2. This assert will prevent developers infliced bugs and development
-	//        and debug configuration.
-	// ./optimizer.c
-	assert(logs != NULL);
-
-	// NOTES:
-	//     1. Since procedures count is validated here, it is not required to be logged in
-	//        any following subprocess. However, I advice to place asserts in all those
-	//        places to catch any possible developer-inflicted bugs.
-	//     2. In case the tokens list is empty (the source was empty of compilable code),
-	//        all the following processes must be skipped and all resources deallocated.
-	if (globals->procedures.count <= 0)
-	{
-		Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, INVALID_LOCATION, "failed to parse any procedures!"));
-
-#if HIVEC_DEBUG
-		Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-			(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-			"locator of the log above this meesage."));
-#endif
-
-		return 0;
-	}
-
-	for (struct LNode* proceduresIterator = globals->procedures.front; proceduresIterator != NULL; proceduresIterator = proceduresIterator->next)
-	{
-		// NOTE: using `assert` and not `if`
-		// REASONS:
-		//     1. The procedures iterator's data, in the list must never be of value
-		//        null.
-		//     2. This assert will prevent developers infliced bugs and development
-		//        and debug configuration.
-		assert(proceduresIterator->data != NULL);
-
-		struct Procedure* procedure = (struct Procedure*)proceduresIterator->data;
-
-		if (procedure->body.count <= 0)
-		{
-			continue;
-		}
-
-		struct Stack stack = Stack_create();
-
-		for (struct LNode* bodyIterator = procedure->body.front; bodyIterator != NULL; bodyIterator = bodyIterator->next)
-		{
-			// NOTE: using `assert` and not `if`
-			// REASONS:
-			//     1. The procedures iterator's data, in the list must never be of value
-			//        null.
-			//     2. This assert will prevent developers infliced bugs and development
-			//        and debug configuration.
-			assert(bodyIterator->data != NULL);
-
-			struct Token* token = (struct Token*)bodyIterator->data;
-
-			switch (token->kind)
-			{
-				case TOKEN_KEYWORD_IF:
-				case TOKEN_KEYWORD_WHILE:
-				{
-					if (stack.count > 0)
-					{
-						struct Token* peeked = (struct Token*)Stack_peek(&stack, 0);
-
-						// NOTE: using `assert` and not `if`
-						// REASONS:
-						//     1. The peeked token, in the stack must never be of value null.
-						//     2. This assert will prevent developers infliced bugs and development
-						//        and debug configuration.
-						assert(peeked != NULL);
-
-						if (peeked->kind == TOKEN_KEYWORD_IF
-						 || peeked->kind == TOKEN_KEYWORD_WHILE)
-						{
-							// TODO: after implementing `with` remove [UNIMPLEMENTED mark for the `with ... ` sequence.
-							Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, peeked->location, "encountered an invalid keyword `%.*s`, following the `%.*s` keyword!",
-								(signed int)token->source.length, token->source.buffer,
-								(signed int)peeked->source.length, peeked->source.buffer));
-
-#if HIVEC_DEBUG
-							Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-								(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-								"locator of the log above this meesage."));
-#endif
-
-							Stack_destroy(&stack);
-							return 0;
-						}
-					}
-
-					Stack_push(&stack, token);
+					context->scopes[context->scopesCount++] = token;
 				} break;
 
 				case TOKEN_KEYWORD_ELSE:
 				{
-					if (stack.count <= 0)
+					if (context->scopesCount <= 1)
 					{
-						Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, token->location, "`%.*s` keyword must follow `if <condition> do <block>` sequence!",
-							(signed int)token->source.length, token->source.buffer));
+						Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, Tokens_location(tokens, token), "`%.*s` keyword must follow `if <condition> do <block>` sequence!",
+							(signed int)tokens->lengths[token], Tokens_source(tokens, token)));
 
 #if HIVEC_DEBUG
 						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
@@ -789,22 +646,14 @@ static signed char Parser_crossReference(
 							"locator of the log above this meesage."));
 #endif
 
-						Stack_destroy(&stack);
 						return 0;
 					}
 
-					struct Token* popped = Stack_pop(&stack);
-
-					// NOTE: using `assert` and not `if`
-					// REASONS:
-					//     1. The popped token, in the stack must never be of value null.
-					//     2. This assert will prevent developers infliced bugs and development
-					//        and debug configuration.
-					assert(popped != NULL);
+					const int64_t popped = context->scopes[--context->scopesCount];
 
-					if (popped->previousRef == NULL)
+					if (tokens->previousRefs[popped] == INVALID_TOKEN)
 					{
-						Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, popped->location, "missing `if` keyword in `if <condition> do` sequence!"));
+						Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, Tokens_location(tokens, popped), "missing `if` keyword in `if <condition> do` sequence!"));
 
 #if HIVEC_DEBUG
 						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
@@ -812,21 +661,20 @@ static signed char Parser_crossReference(
 							"locator of the log above this meesage."));
 #endif
 
-						Stack_destroy(&stack);
 						return 0;
 					}
 
-					if (popped->kind == TOKEN_KEYWORD_DO
-					 && popped->previousRef->kind == TOKEN_KEYWORD_IF)
+					if (tokens->kinds[popped] == TOKEN_KEYWORD_DO
+					 && tokens->kinds[tokens->previousRefs[popped]] == TOKEN_KEYWORD_IF)
 					{
-						popped->nextRef = token;
-						token->previousRef = popped;
-						Stack_push(&stack, token);
+						tokens->nextRefs[popped] = token;
+						tokens->previousRefs[token] = popped;
+						context->scopes[context->scopesCount++] = token;
 					}
 					else
 					{
-						Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, token->location, "`%.*s` keyword must follow `if <condition> do <block>` sequence!",
-							(signed int)token->source.length, token->source.buffer));
+						Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, Tokens_location(tokens, token), "`%.*s` keyword must follow `if <condition> do <block>` sequence!",
+							(signed int)tokens->lengths[token], Tokens_source(tokens, token)));
 
 #if HIVEC_DEBUG
 						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
@@ -834,50 +682,27 @@ static signed char Parser_crossReference(
 							"locator of the log above this meesage."));
 #endif
 
-						Stack_destroy(&stack);
 						return 0;
 					}
 				} break;
 
 				case TOKEN_KEYWORD_DO:
 				{
-					if (stack.count <= 0)
-					{
-						// TODO: after implementing `with` remove [UNIMPLEMENTED mark for the `with ... ` sequence.
-						Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, token->location, "`%.*s` keyword must follow `if <condition>`, `while <condition>`, or `[UNIMPLEMENTED] with <identifiers>` sequence!",
-							(signed int)token->source.length, token->source.buffer));
+					const int64_t popped = context->scopes[context->scopesCount - 1];
 
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
-
-						Stack_destroy(&stack);
-						return 0;
-					}
-
-					struct Token* popped = Stack_pop(&stack);
-
-					// NOTE: using `assert` and not `if`
-					// REASONS:
-					//     1. The popped token, in the stack must never be of value null.
-					//     2. This assert will prevent developers infliced bugs and development
-					//        and debug configuration.
-					assert(popped != NULL);
-
-					if (popped->kind == TOKEN_KEYWORD_IF
-					 || popped->kind == TOKEN_KEYWORD_WHILE)
+					if (context->scopesCount > 1
+					 && (tokens->kinds[popped] == TOKEN_KEYWORD_IF
+					  || tokens->kinds[popped] == TOKEN_KEYWORD_WHILE))
 					{
-						popped->nextRef = token;
-						token->previousRef = popped;
-						Stack_push(&stack, token);
+						tokens->nextRefs[popped] = token;
+						tokens->previousRefs[token] = popped;
+						context->scopes[context->scopesCount - 1] = token;
 					}
 					else
 					{
 						// TODO: after implementing `with` remove [UNIMPLEMENTED mark for the `with ... ` sequence.
-						Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, token->location, "`%.*s` keyword must follow `if <condition>`, `while <condition>`, or `[UNIMPLEMENTED] with <identifiers>` sequence!",
-							(signed int)token->source.length, token->source.buffer));
+						Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, Tokens_location(tokens, token), "`%.*s` keyword must follow `if <condition>`, `while <condition>`, or `[UNIMPLEMENTED] with <identifiers>` sequence!",
+							(signed int)tokens->lengths[token], Tokens_source(tokens, token)));
 
 #if HIVEC_DEBUG
 						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
@@ -885,76 +710,46 @@ static signed char Parser_crossReference(
 							"locator of the log above this meesage."));
 #endif
 
-						Stack_destroy(&stack);
 						return 0;
 					}
 				} break;
 
 				case TOKEN_KEYWORD_END:
 				{
-					if (stack.count <= 0)
-					{
-						// TODO: after implementing `with` remove [UNIMPLEMENTED mark for the `with ... ` sequence.
-						Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, token->location, "`%.*s` keyword must follow `if <condition> do <block>`, `if <condition> do <block> else <block>`, `while <condition> do <block>`, or `[UNIMPLEMENTED] with <identifiers> do <block>` sequence!",
-							(signed int)token->source.length, token->source.buffer));
+					const int64_t popped = context->scopes[--context->scopesCount];
 
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
-
-						Stack_destroy(&stack);
-						return 0;
+					if (context->scopesCount <= 0)
+					{
+						// The body ends right before the procedure's closing `end`
+						procedure->body.end = token;
+						return 1;
 					}
 
-					struct Token* popped = Stack_pop(&stack);
-
-					// NOTE: using `assert` and not `if`
-					// REASONS:
-					//     1. The popped token, in the stack must never be of value null.
-					//     2. This assert will prevent developers infliced bugs and development
-					//        and debug configuration.
-					assert(popped != NULL);
-
-					if (popped->kind == TOKEN_KEYWORD_DO)
+					if (tokens->kinds[popped] == TOKEN_KEYWORD_DO)
 					{
-						if (popped->previousRef->kind == TOKEN_KEYWORD_IF)
-						{
-							popped->nextRef = token;
-							token->previousRef = popped;
-						}
-						else if (popped->previousRef->kind == TOKEN_KEYWORD_WHILE)
+						if (tokens->kinds[tokens->previousRefs[popped]] == TOKEN_KEYWORD_IF)
 						{
-							popped->nextRef = token;
-							token->previousRef = popped;
-							token->nextRef = popped->previousRef;
+							tokens->nextRefs[popped] = token;
+							tokens->previousRefs[token] = popped;
 						}
 						else
 						{
-							Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, token->location, "encountered invalid keyword `%.*s` before the `do` keyword!",
-								(signed int)popped->source.length, popped->source.buffer));
-
-#if HIVEC_DEBUG
-							Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-								(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-								"locator of the log above this meesage."));
-#endif
-
-							Stack_destroy(&stack);
-							return 0;
+							// Closing a `while`, whose `end` jumps back to the condition
+							tokens->nextRefs[popped] = token;
+							tokens->previousRefs[token] = popped;
+							tokens->nextRefs[token] = tokens->previousRefs[popped];
 						}
 					}
-					else if (popped->kind == TOKEN_KEYWORD_ELSE)
+					else if (tokens->kinds[popped] == TOKEN_KEYWORD_ELSE)
 					{
-						popped->nextRef = token;
-						token->previousRef = popped;
+						tokens->nextRefs[popped] = token;
+						tokens->previousRefs[token] = popped;
 					}
 					else
 					{
 						// TODO: after implementing `with` remove [UNIMPLEMENTED mark for the `with ... ` sequence.
-						Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, token->location, "`%.*s` keyword must follow `if <condition> do <block>`, `if <condition> do <block> else <block>`, `while <condition> do <block>`, or `[UNIMPLEMENTED] with <identifiers> do <block>` sequence!",
-							(signed int)token->source.length, token->source.buffer));
+						Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, Tokens_location(tokens, token), "`%.*s` keyword must follow `if <condition> do <block>`, `if <condition> do <block> else <block>`, `while <condition> do <block>`, or `[UNIMPLEMENTED] with <identifiers> do <block>` sequence!",
+							(signed int)tokens->lengths[token], Tokens_source(tokens, token)));
 
 #if HIVEC_DEBUG
 						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
@@ -962,24 +757,40 @@ static signed char Parser_crossReference(
 							"locator of the log above this meesage."));
 #endif
 
-						Stack_destroy(&stack);
 						return 0;
 					}
 				} break;
 
+				case TOKEN_KEYWORD_PROCEDURE:
+				case TOKEN_KEYWORD_REQUIRE:
+				case TOKEN_KEYWORD_RETURN:
+				case TOKEN_KEYWORD_I64:
+				case TOKEN_KEYWORD_P64:
+				{
+					Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, Tokens_location(tokens, token), "encountered invalid token `%.*s` in procedure's body!",
+						(signed int)tokens->lengths[token], Tokens_source(tokens, token)));
+
+#if HIVEC_DEBUG
+					Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+						(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+						"locator of the log above this meesage."));
+#endif
+
+					return 0;
+				} break;
+
 				default:
 				{
 				} break;
 			}
 		}
 
-		if (stack.count > 0)
+		if (context->scopesCount > 0)
 		{
-			struct Token* unhandled = NULL;
-
-			while ((unhandled = Stack_pop(&stack)) != NULL)
+			while (context->scopesCount > 0)
 			{
-				Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, unhandled->location, "encountered an unhandled token `%.*s`!", (signed int)unhandled->source.length, unhandled->source.buffer));
+				const int64_t unhandled = context->scopes[--context->scopesCount];
+				Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, Tokens_location(tokens, unhandled), "encountered an unhandled token `%.*s`!", (signed int)tokens->lengths[unhandled], Tokens_source(tokens, unhandled)));
 
 #if HIVEC_DEBUG
 				Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
@@ -988,16 +799,247 @@ static signed char Parser_crossReference(
 #endif
 			}
 
-			Stack_destroy(&stack);
 			return 0;
 		}
 
-		Stack_destroy(&stack);
+	}
+	else
+	{
+		Queue_enqueue(logs, Log_create("parser", SEVERITY_ERROR, Tokens_location(tokens, token), "encountered an invalid keyword `%.*s` instead of `do` keyword after procedure's definition!", (signed int)tokens->lengths[token], Tokens_source(tokens, token)));
+
+#if HIVEC_DEBUG
+		Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+			(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+			"locator of the log above this meesage."));
+#endif
+
+		return 0;
 	}
 
 	return 1;
 }
 
+static int64_t Parser_countInstructions(
+	const struct Tokens* const tokens,
+	const int64_t token)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The tokens, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(tokens != NULL);
+
+	switch (tokens->kinds[token])
+	{
+		case TOKEN_IDENTIFIER:
+		case TOKEN_KEYWORD_ELSE:
+		case TOKEN_KEYWORD_DO:
+		case TOKEN_LITERAL_I64:
+		case TOKEN_LITERAL_STRING:
+		{
+			return 1;
+		} break;
+
+		case TOKEN_KEYWORD_END:
+		{
+			// Only the `end` of a `while` jumps back to its condition
+			return tokens->nextRefs[token] != INVALID_TOKEN ? 1 : 0;
+		} break;
+
+		default:
+		{
+			return tokens->kinds[token] >= TOKEN_FIRST_INTRINSIC && tokens->kinds[token] <= TOKEN_LAST_INTRINSIC ? 1 : 0;
+		} break;
+	}
+}
+
+static void Parser_lowerProcedure(
+	const struct Globals* const globals,
+	struct Arena* const arena,
+	struct Procedure* const procedure,
+	struct ParserContext* const context)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The globals, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(globals != NULL);
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The procedure, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(procedure != NULL);
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The context, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(context != NULL);
+
+	static_assert(OPCODE_LAST_INTRINSIC - OPCODE_FIRST_INTRINSIC == TOKEN_LAST_INTRINSIC - TOKEN_FIRST_INTRINSIC,
+		"Intrinsic opcodes must follow the intrinsic token kinds one to one!");
+
+	// STEPS:
+	//     1. Number the instructions of every body's token, so the forward jumps know their
+	//        targets before they are lowered.
+	//     2. Lower the tokens into the instructions, closing the body with the return.
+	// 
+	// NOTES:
+	//     1. The `if` and `while` keywords, and the `end` of an `if` produce no instructions,
+	//        the jumps land on the instruction, that follows them.
+	//     2. The procedure's closing `end` token is the return's source location id, so every
+	//        jump target is an instruction.
+
+	const struct Tokens* tokens = context->tokens;
+	const int64_t begin = procedure->body.begin;
+	const int64_t end = procedure->body.end;
+	int64_t* instructions = context->instructions;
+	const int64_t first = context->first;
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The body of a parsed procedure always ends with its closing `end` token, an
+	//        empty body begins at it.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(begin <= end && end < tokens->count && tokens->kinds[end] == TOKEN_KEYWORD_END);
+
+	// [STEP 1] (Number the instructions of every body's token).
+	int64_t count = 0;
+
+	for (int64_t token = begin; token < end; ++token)
+	{
+		instructions[token - first] = count;
+		count += Parser_countInstructions(tokens, token);
+	}
+
+	instructions[end - first] = count++;
+
+	// [STEP 2] (Lower the tokens into the instructions).
+	procedure->instructions = (struct Instruction*)Arena_allocate(arena, count * (int64_t)sizeof(struct Instruction));
+	procedure->instructionsCount = count;
+
+	for (int64_t token = begin; token < end; ++token)
+	{
+		if (Parser_countInstructions(tokens, token) <= 0)
+		{
+			continue;
+		}
+
+		struct Instruction* instruction = &procedure->instructions[instructions[token - first]];
+		instruction->operand = 0;
+		instruction->target = INVALID_INSTRUCTION;
+		instruction->token = (uint32_t)token;
+		instruction->depth = 0;
+
+		switch (tokens->kinds[token])
+		{
+			case TOKEN_IDENTIFIER:
+			{
+				instruction->opcode = OPCODE_CALL;
+				instruction->operand = tokens->symbolIds[token];
+			} break;
+
+			case TOKEN_KEYWORD_ELSE:
+			{
+				// Skipping the else block, the `end` of an `if` produces no instructions
+				instruction->opcode = OPCODE_JUMP;
+				instruction->target = (uint32_t)(instructions[tokens->nextRefs[token] - first]);
+			} break;
+
+			case TOKEN_KEYWORD_DO:
+			{
+				// Jumping past the `else` jump, or past the `end` (and its jump, for a `while`)
+				const int64_t next = tokens->nextRefs[token];
+				instruction->opcode = OPCODE_JUMP_UNLESS;
+				instruction->target = (uint32_t)(instructions[next - first] + Parser_countInstructions(tokens, next));
+			} break;
+
+			case TOKEN_KEYWORD_END:
+			{
+				// Jumping back to the condition, that follows the `while`
+				instruction->opcode = OPCODE_JUMP;
+				instruction->target = (uint32_t)(instructions[tokens->nextRefs[token] - first]);
+			} break;
+
+			case TOKEN_LITERAL_I64:
+			{
+				instruction->opcode = OPCODE_PUSH_I64;
+				instruction->operand = tokens->values[token].i64;
+			} break;
+
+			case TOKEN_LITERAL_STRING:
+			{
+				instruction->opcode = OPCODE_PUSH_STRING;
+				instruction->operand = Globals_stringIndex(globals, token);
+			} break;
+
+			default:
+			{
+				instruction->opcode = (unsigned char)(OPCODE_FIRST_INTRINSIC + (tokens->kinds[token] - TOKEN_FIRST_INTRINSIC));
+			} break;
+		}
+	}
+
+	struct Instruction* instruction = &procedure->instructions[count - 1];
+	instruction->opcode = OPCODE_RETURN;
+	instruction->operand = 0;
+	instruction->target = INVALID_INSTRUCTION;
+	instruction->token = (uint32_t)end;
+	instruction->depth = 0;
+}
+
+static void Parser_resolveCalls(
+	const struct Globals* const globals)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The globals, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(globals != NULL);
+
+	// NOTES:
+	//     1. The calls are lowered with the symbol ids of the called names, since a procedure
+	//        can call the ones, that are defined after it. Once all procedures are defined,
+	//        every call is resolved into the called procedure's index, so neither the
+	//        validator, nor the translator look the names up.
+	//     2. The calls of the undefined procedures are left with the `INVALID_PROCEDURE`
+	//        and are reported by the validator, in the order of the other diagnostics.
+	for (int64_t index = 0; index < globals->procedures.count; ++index)
+	{
+		Parser_resolveProcedureCalls(globals, (struct Procedure*)List_at(&globals->procedures, index));
+	}
+}
+
+static void Parser_resolveProcedureCalls(
+	const struct Globals* const globals,
+	struct Procedure* const procedure)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The procedure, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(procedure != NULL);
+
+	for (int64_t index = 0; index < procedure->instructionsCount; ++index)
+	{
+		struct Instruction* instruction = &procedure->instructions[index];
+
+		if (instruction->opcode == OPCODE_CALL)
+		{
+			const struct Procedure* calledProcedure = Globals_find(globals, instruction->operand);
+			instruction->operand = calledProcedure != NULL ? calledProcedure->index : INVALID_PROCEDURE;
+		}
+	}
+}
+
 /**
  * @}
  */
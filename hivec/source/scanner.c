@@ -0,0 +1,476 @@
+/**
+ * @file scanner.c
+ *
+ * @copyright This file is a part of the project hivelang and is distributed under MIT license that
+ * should have been included with the project. If not, see https://choosealicense.com/licenses/mit/
+ *
+ * @author joba14
+ *
+ * @date 2022-09-10
+ */
+
+#include <scanner.h>
+
+#include <assert.h>
+#include <stdlib.h>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#	include <immintrin.h>
+#	define SCANNER_HAS_SSE2 1
+#	define SCANNER_HAS_AVX2 1
+#else
+#	define SCANNER_HAS_SSE2 0
+#	define SCANNER_HAS_AVX2 0
+#endif
+
+/**
+ * @addtogroup scanner
+ *
+ * @{
+ */
+
+#define W SCANNER_CLASS_WHITESPACE
+#define I SCANNER_CLASS_IDENTIFIER
+#define D (SCANNER_CLASS_IDENTIFIER | SCANNER_CLASS_DIGIT)
+
+const unsigned char scannerClasses[256] =
+{
+	['\t'] = W, ['\n'] = W, ['\r'] = W, [' '] = W,
+
+	['0'] = D, ['1'] = D, ['2'] = D, ['3'] = D, ['4'] = D,
+	['5'] = D, ['6'] = D, ['7'] = D, ['8'] = D, ['9'] = D,
+
+	['_'] = I, ['?'] = I,
+
+	['A'] = I, ['B'] = I, ['C'] = I, ['D'] = I, ['E'] = I, ['F'] = I, ['G'] = I,
+	['H'] = I, ['I'] = I, ['J'] = I, ['K'] = I, ['L'] = I, ['M'] = I, ['N'] = I,
+	['O'] = I, ['P'] = I, ['Q'] = I, ['R'] = I, ['S'] = I, ['T'] = I, ['U'] = I,
+	['V'] = I, ['W'] = I, ['X'] = I, ['Y'] = I, ['Z'] = I,
+
+	['a'] = I, ['b'] = I, ['c'] = I, ['d'] = I, ['e'] = I, ['f'] = I, ['g'] = I,
+	['h'] = I, ['i'] = I, ['j'] = I, ['k'] = I, ['l'] = I, ['m'] = I, ['n'] = I,
+	['o'] = I, ['p'] = I, ['q'] = I, ['r'] = I, ['s'] = I, ['t'] = I, ['u'] = I,
+	['v'] = I, ['w'] = I, ['x'] = I, ['y'] = I, ['z'] = I
+};
+
+#undef W
+#undef I
+#undef D
+
+/**
+ * [PRIVATE] Set of the scanning kernels of one level.
+ */
+struct ScannerKernels
+{
+	const char* (*skipWhitespace)(const char*, const char* const);
+	const char* (*skipIdentifier)(const char*, const char* const);
+	const char* (*skipWord)(const char*, const char* const);
+};
+
+static const char* Scanner_skipWhitespaceScalar(
+	const char* begin,
+	const char* const end);
+
+static const char* Scanner_skipIdentifierScalar(
+	const char* begin,
+	const char* const end);
+
+static const char* Scanner_skipWordScalar(
+	const char* begin,
+	const char* const end);
+
+#if SCANNER_HAS_SSE2
+static const char* Scanner_skipWhitespaceSSE2(
+	const char* begin,
+	const char* const end);
+
+static const char* Scanner_skipIdentifierSSE2(
+	const char* begin,
+	const char* const end);
+
+static const char* Scanner_skipWordSSE2(
+	const char* begin,
+	const char* const end);
+#endif
+
+#if SCANNER_HAS_AVX2
+static const char* Scanner_skipWhitespaceAVX2(
+	const char* begin,
+	const char* const end);
+
+static const char* Scanner_skipIdentifierAVX2(
+	const char* begin,
+	const char* const end);
+
+static const char* Scanner_skipWordAVX2(
+	const char* begin,
+	const char* const end);
+#endif
+
+static signed char Scanner_isSupported(
+	const enum ScannerLevel level);
+
+static const struct ScannerKernels scannerKernels[SCANNER_LEVELS_COUNT] =
+{
+	[SCANNER_LEVEL_SCALAR] = { Scanner_skipWhitespaceScalar, Scanner_skipIdentifierScalar, Scanner_skipWordScalar },
+#if SCANNER_HAS_SSE2
+	[SCANNER_LEVEL_SSE2] = { Scanner_skipWhitespaceSSE2, Scanner_skipIdentifierSSE2, Scanner_skipWordSSE2 },
+#endif
+#if SCANNER_HAS_AVX2
+	[SCANNER_LEVEL_AVX2] = { Scanner_skipWhitespaceAVX2, Scanner_skipIdentifierAVX2, Scanner_skipWordAVX2 },
+#endif
+};
+
+// NOTE: the count of characters, that are classified one by one, before handing the rest of
+//       the run to the selected kernels.
+#define SCANNER_PREFIX_LENGTH ((int64_t)8)
+
+// NOTE: the scalar kernels are selected until `Scanner_initialize` is called, so the scanner
+//       is always usable. Selecting happens once, before any source is lexed.
+static const struct ScannerKernels* selectedKernels = &scannerKernels[SCANNER_LEVEL_SCALAR];
+
+enum ScannerLevel Scanner_initialize(
+	void)
+{
+	for (int64_t level = SCANNER_LEVELS_COUNT - 1; level > SCANNER_LEVEL_SCALAR; --level)
+	{
+		if (Scanner_select((enum ScannerLevel)level))
+		{
+			return (enum ScannerLevel)level;
+		}
+	}
+
+	selectedKernels = &scannerKernels[SCANNER_LEVEL_SCALAR];
+	return SCANNER_LEVEL_SCALAR;
+}
+
+signed char Scanner_select(
+	const enum ScannerLevel level)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The level, provided to this function, must be one of the levels.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(level >= SCANNER_LEVEL_SCALAR && level < SCANNER_LEVELS_COUNT);
+
+	if (!Scanner_isSupported(level))
+	{
+		return 0;
+	}
+
+	selectedKernels = &scannerKernels[level];
+	return 1;
+}
+
+const char* Scanner_stringifyLevel(
+	const enum ScannerLevel level)
+{
+	switch (level)
+	{
+		case SCANNER_LEVEL_SCALAR: { return "scalar"; }
+		case SCANNER_LEVEL_SSE2: { return "sse2"; }
+		case SCANNER_LEVEL_AVX2: { return "avx2"; }
+		default: { return "invalid"; }
+	}
+}
+
+const char* Scanner_skipWhitespace(
+	const char* begin,
+	const char* const end)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The range, provided to this function, must never ever be null or reversed.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(begin != NULL && end != NULL && begin <= end);
+
+	// Most runs are a few characters long, and end before a block would be even loaded
+	for (const char* const prefixEnd = end - begin > SCANNER_PREFIX_LENGTH ? begin + SCANNER_PREFIX_LENGTH : end; begin < prefixEnd; ++begin)
+	{
+		if (!(scannerClasses[(unsigned char)*begin] & SCANNER_CLASS_WHITESPACE))
+		{
+			return begin;
+		}
+	}
+
+	return selectedKernels->skipWhitespace(begin, end);
+}
+
+const char* Scanner_skipIdentifier(
+	const char* begin,
+	const char* const end)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The range, provided to this function, must never ever be null or reversed.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(begin != NULL && end != NULL && begin <= end);
+
+	// Most runs are a few characters long, and end before a block would be even loaded
+	for (const char* const prefixEnd = end - begin > SCANNER_PREFIX_LENGTH ? begin + SCANNER_PREFIX_LENGTH : end; begin < prefixEnd; ++begin)
+	{
+		if (!(scannerClasses[(unsigned char)*begin] & SCANNER_CLASS_IDENTIFIER))
+		{
+			return begin;
+		}
+	}
+
+	return selectedKernels->skipIdentifier(begin, end);
+}
+
+const char* Scanner_skipWord(
+	const char* begin,
+	const char* const end)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The range, provided to this function, must never ever be null or reversed.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(begin != NULL && end != NULL && begin <= end);
+
+	// Most runs are a few characters long, and end before a block would be even loaded
+	for (const char* const prefixEnd = end - begin > SCANNER_PREFIX_LENGTH ? begin + SCANNER_PREFIX_LENGTH : end; begin < prefixEnd; ++begin)
+	{
+		if (scannerClasses[(unsigned char)*begin] & SCANNER_CLASS_WHITESPACE)
+		{
+			return begin;
+		}
+	}
+
+	return selectedKernels->skipWord(begin, end);
+}
+
+static const char* Scanner_skipWhitespaceScalar(
+	const char* begin,
+	const char* const end)
+{
+	while (begin < end && (scannerClasses[(unsigned char)*begin] & SCANNER_CLASS_WHITESPACE))
+	{
+		++begin;
+	}
+
+	return begin;
+}
+
+static const char* Scanner_skipIdentifierScalar(
+	const char* begin,
+	const char* const end)
+{
+	while (begin < end && (scannerClasses[(unsigned char)*begin] & SCANNER_CLASS_IDENTIFIER))
+	{
+		++begin;
+	}
+
+	return begin;
+}
+
+static const char* Scanner_skipWordScalar(
+	const char* begin,
+	const char* const end)
+{
+	while (begin < end && !(scannerClasses[(unsigned char)*begin] & SCANNER_CLASS_WHITESPACE))
+	{
+		++begin;
+	}
+
+	return begin;
+}
+
+// NOTES:
+//     1. The vectorized kernels only load whole blocks, that lie inside of the range, and let
+//        the scalar kernels finish the tail. Reading past the end is never safe here, since the
+//        source buffer might be a memory-mapped file, that ends at a page boundary.
+//     2. Every block is turned into a mask with one bit per character, set in case the
+//        character belongs to the class. The first character, that does not belong, is the
+//        lowest clear bit of the mask.
+//     3. Characters above 0x7f are negative for the signed compares, so they never fall into
+//        the letters and digits ranges, exactly as with the classes table.
+
+#if SCANNER_HAS_SSE2
+static inline __m128i Scanner_whitespaceMask16(
+	const __m128i block)
+{
+	return _mm_or_si128(
+		_mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(block, _mm_set1_epi8('\t'))),
+		_mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(block, _mm_set1_epi8('\r'))));
+}
+
+static inline __m128i Scanner_identifierMask16(
+	const __m128i block)
+{
+	// Setting the 0x20 bit folds upper case letters onto the lower case ones
+	const __m128i folded = _mm_or_si128(block, _mm_set1_epi8(0x20));
+	const __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(folded, _mm_set1_epi8('a' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('z' + 1), folded));
+	const __m128i digits = _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8('0' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), block));
+	const __m128i symbols = _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('_')), _mm_cmpeq_epi8(block, _mm_set1_epi8('?')));
+	return _mm_or_si128(_mm_or_si128(letters, digits), symbols);
+}
+
+static const char* Scanner_skipWhitespaceSSE2(
+	const char* begin,
+	const char* const end)
+{
+	for (; end - begin >= 16; begin += 16)
+	{
+		const uint32_t mask = (uint32_t)_mm_movemask_epi8(Scanner_whitespaceMask16(_mm_loadu_si128((const __m128i*)begin)));
+
+		if (mask != 0xffff)
+		{
+			return begin + __builtin_ctz(~mask);
+		}
+	}
+
+	return Scanner_skipWhitespaceScalar(begin, end);
+}
+
+static const char* Scanner_skipIdentifierSSE2(
+	const char* begin,
+	const char* const end)
+{
+	for (; end - begin >= 16; begin += 16)
+	{
+		const uint32_t mask = (uint32_t)_mm_movemask_epi8(Scanner_identifierMask16(_mm_loadu_si128((const __m128i*)begin)));
+
+		if (mask != 0xffff)
+		{
+			return begin + __builtin_ctz(~mask);
+		}
+	}
+
+	return Scanner_skipIdentifierScalar(begin, end);
+}
+
+static const char* Scanner_skipWordSSE2(
+	const char* begin,
+	const char* const end)
+{
+	for (; end - begin >= 16; begin += 16)
+	{
+		const uint32_t mask = (uint32_t)_mm_movemask_epi8(Scanner_whitespaceMask16(_mm_loadu_si128((const __m128i*)begin)));
+
+		if (mask != 0)
+		{
+			return begin + __builtin_ctz(mask);
+		}
+	}
+
+	return Scanner_skipWordScalar(begin, end);
+}
+#endif
+
+#if SCANNER_HAS_AVX2
+__attribute__((target("avx2")))
+static inline __m256i Scanner_whitespaceMask32(
+	const __m256i block)
+{
+	return _mm256_or_si256(
+		_mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\t'))),
+		_mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8('\n')), _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\r'))));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i Scanner_identifierMask32(
+	const __m256i block)
+{
+	// Setting the 0x20 bit folds upper case letters onto the lower case ones
+	const __m256i folded = _mm256_or_si256(block, _mm256_set1_epi8(0x20));
+	const __m256i letters = _mm256_and_si256(_mm256_cmpgt_epi8(folded, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), folded));
+	const __m256i digits = _mm256_and_si256(_mm256_cmpgt_epi8(block, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), block));
+	const __m256i symbols = _mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8('_')), _mm256_cmpeq_epi8(block, _mm256_set1_epi8('?')));
+	return _mm256_or_si256(_mm256_or_si256(letters, digits), symbols);
+}
+
+__attribute__((target("avx2")))
+static const char* Scanner_skipWhitespaceAVX2(
+	const char* begin,
+	const char* const end)
+{
+	for (; end - begin >= 32; begin += 32)
+	{
+		const uint32_t mask = (uint32_t)_mm256_movemask_epi8(Scanner_whitespaceMask32(_mm256_loadu_si256((const __m256i*)begin)));
+
+		if (mask != 0xffffffff)
+		{
+			return begin + __builtin_ctz(~mask);
+		}
+	}
+
+	return Scanner_skipWhitespaceSSE2(begin, end);
+}
+
+__attribute__((target("avx2")))
+static const char* Scanner_skipIdentifierAVX2(
+	const char* begin,
+	const char* const end)
+{
+	for (; end - begin >= 32; begin += 32)
+	{
+		const uint32_t mask = (uint32_t)_mm256_movemask_epi8(Scanner_identifierMask32(_mm256_loadu_si256((const __m256i*)begin)));
+
+		if (mask != 0xffffffff)
+		{
+			return begin + __builtin_ctz(~mask);
+		}
+	}
+
+	return Scanner_skipIdentifierSSE2(begin, end);
+}
+
+__attribute__((target("avx2")))
+static const char* Scanner_skipWordAVX2(
+	const char* begin,
+	const char* const end)
+{
+	for (; end - begin >= 32; begin += 32)
+	{
+		const uint32_t mask = (uint32_t)_mm256_movemask_epi8(Scanner_whitespaceMask32(_mm256_loadu_si256((const __m256i*)begin)));
+
+		if (mask != 0)
+		{
+			return begin + __builtin_ctz(mask);
+		}
+	}
+
+	return Scanner_skipWordSSE2(begin, end);
+}
+#endif
+
+static signed char Scanner_isSupported(
+	const enum ScannerLevel level)
+{
+	switch (level)
+	{
+		case SCANNER_LEVEL_SCALAR:
+		{
+			return 1;
+		}
+
+		case SCANNER_LEVEL_SSE2:
+		{
+			// NOTE: SSE2 is a part of the x86-64 baseline.
+			return SCANNER_HAS_SSE2;
+		}
+
+		case SCANNER_LEVEL_AVX2:
+		{
+#if SCANNER_HAS_AVX2
+			return __builtin_cpu_supports("avx2") ? 1 : 0;
+#else
+			return 0;
+#endif
+		}
+
+		default:
+		{
+			return 0;
+		}
+	}
+}
+
+/**
+ * @}
+ */
@@ -11,7 +11,6 @@
  */
 
 #include <translator.h>
-#include <hash256.h>
 
 #include <assert.h>
 #include <stdlib.h>
@@ -24,8 +23,9 @@
  * @{
  */
 
-static void Translator_translateProcedure(
+static void Translator_translateInstructions(
 	FILE* const file,
+	const struct Globals* const globals,
 	const struct Procedure* const procedure);
 
 signed char Translator_translateTokens(
@@ -33,6 +33,48 @@ signed char Translator_translateTokens(
 	struct Globals* const globals,
 	struct Queue* const logs)
 {
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The globals, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(globals != NULL);
+
+	// NOTE: this error is being logged in parser function before entering
+	//       this function.
+	assert(globals->procedures.count > 0);
+
+	struct Translator translator = {0};
+
+	if (!Translator_open(&translator, filePath, logs))
+	{
+		return 0;
+	}
+
+	for (int64_t index = 0; index < globals->procedures.count; ++index)
+	{
+		struct Procedure* procedure = (struct Procedure*)List_at(&globals->procedures, index);
+
+		Translator_translateProcedure(&translator, globals, procedure);
+	}
+
+	Translator_translateStringLiterals(&translator, globals);
+	Translator_close(&translator);
+	return 1;
+}
+
+signed char Translator_open(
+	struct Translator* const translator,
+	const char* filePath,
+	struct Queue* const logs)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The translator, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(translator != NULL);
+
 	// NOTE: using `assert` and not `if`
 	// REASONS:
 	//     1. The filePath, provided to this function, must never ever be null.
@@ -40,6 +82,13 @@ signed char Translator_translateTokens(
 	//        and debug configuration.
 	assert(filePath != NULL);
 
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The logs, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(logs != NULL);
+
 	// NOTE: not marking as debug-only.
 	// REASONS:
 	//     1. Provided file path can theoretically be empty string, that, while
@@ -58,156 +107,179 @@ signed char Translator_translateTokens(
 		return 0;
 	}
 
-	// NOTE: using `assert` and not `if`
-	// REASONS:
-	//     1. The globals, provided to this function, must never ever be null.
-	//     2. This assert will prevent developers infliced bugs and development
-	//        and debug configuration.
-	assert(globals != NULL);
+	translator->file = fopen(filePath, "w");
+	translator->stringLiteralsCount = 0;
+	translator->isInData = 0;
 
-	// NOTE: using `assert` and not `if`
+	// NOTE: not marking as debug-only.
 	// REASONS:
-	//     1. The logs, provided to this function, must never ever be null.
-	//     2. This assert will prevent developers infliced bugs and development
-	//        and debug configuration.
-	assert(logs != NULL);
+	//     1. The output file might not be creatable (due to a missing directory or the
+	//        permissions) and must be reported accordingly.
+	if (translator->file == NULL)
+	{
+		Queue_enqueue(logs, Log_create("translator", SEVERITY_ERROR, INVALID_LOCATION, "failed to open IR file with path `%s`!", filePath));
 
-	// NOTE: this error is being logged in parser function before entering
-	//       this function.
-	assert(globals->procedures.count > 0);
+#if HIVEC_DEBUG
+		Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+			(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+			"locator of the log above this meesage."));
+#endif
 
-	FILE* file = fopen(filePath, "w");
+		return 0;
+	}
 
-	fprintf(file, "\n");
-	fprintf(file, "BITS 64\n");
-	fprintf(file, "\n");
-	fprintf(file, "segment .text\n");
-	fprintf(file, "\n");
+	fprintf(translator->file, "\n");
+	fprintf(translator->file, "BITS 64\n");
+	fprintf(translator->file, "\n");
+	fprintf(translator->file, "segment .text\n");
+	fprintf(translator->file, "\n");
 
 #if HIVEC_DEBUG
 	// TODO: remove this block.
-	fprintf(file, "printn:\n");
-	fprintf(file, "\tmov r9, -3689348814741910323\n");
-	fprintf(file, "\tsub rsp, 40\n");
-	fprintf(file, "\tmov BYTE [rsp + 31], 10\n");
-	fprintf(file, "\tlea rcx, [rsp + 30]\n");
-	fprintf(file, "\n");
-
-	fprintf(file, ".L2:\n");
-	fprintf(file, "\tmov rax, rdi\n");
-	fprintf(file, "\tlea r8, [rsp + 32]\n");
-	fprintf(file, "\tmul r9\n");
-	fprintf(file, "\tmov rax, rdi\n");
-	fprintf(file, "\tsub r8, rcx\n");
-	fprintf(file, "\tshr rdx, 3\n");
-	fprintf(file, "\tlea rsi, [rdx + rdx * 4]\n");
-	fprintf(file, "\tadd rsi, rsi\n");
-	fprintf(file, "\tsub rax, rsi\n");
-	fprintf(file, "\tadd eax, 48\n");
-	fprintf(file, "\tmov BYTE [rcx], al\n");
-	fprintf(file, "\tmov rax, rdi\n");
-	fprintf(file, "\tmov rdi, rdx\n");
-	fprintf(file, "\tmov rdx, rcx\n");
-	fprintf(file, "\tsub rcx, 1\n");
-	fprintf(file, "\tcmp rax, 9\n");
-	fprintf(file, "\tja .L2\n");
-	fprintf(file, "\tlea rax, [rsp + 32]\n");
-	fprintf(file, "\tmov edi, 1\n");
-	fprintf(file, "\tsub rdx, rax\n");
-	fprintf(file, "\txor eax, eax\n");
-	fprintf(file, "\tlea rsi, [rsp + 32 + rdx]\n");
-	fprintf(file, "\tmov rdx, r8\n");
-	fprintf(file, "\tmov rax, 1\n");
-	fprintf(file, "\tsyscall\n");
-	fprintf(file, "\tadd rsp, 40\n");
-	fprintf(file, "\tret\n");
+	fprintf(translator->file, "printn:\n");
+	fprintf(translator->file, "\tmov r9, -3689348814741910323\n");
+	fprintf(translator->file, "\tsub rsp, 40\n");
+	fprintf(translator->file, "\tmov BYTE [rsp + 31], 10\n");
+	fprintf(translator->file, "\tlea rcx, [rsp + 30]\n");
+	fprintf(translator->file, "\n");
+
+	fprintf(translator->file, ".L2:\n");
+	fprintf(translator->file, "\tmov rax, rdi\n");
+	fprintf(translator->file, "\tlea r8, [rsp + 32]\n");
+	fprintf(translator->file, "\tmul r9\n");
+	fprintf(translator->file, "\tmov rax, rdi\n");
+	fprintf(translator->file, "\tsub r8, rcx\n");
+	fprintf(translator->file, "\tshr rdx, 3\n");
+	fprintf(translator->file, "\tlea rsi, [rdx + rdx * 4]\n");
+	fprintf(translator->file, "\tadd rsi, rsi\n");
+	fprintf(translator->file, "\tsub rax, rsi\n");
+	fprintf(translator->file, "\tadd eax, 48\n");
+	fprintf(translator->file, "\tmov BYTE [rcx], al\n");
+	fprintf(translator->file, "\tmov rax, rdi\n");
+	fprintf(translator->file, "\tmov rdi, rdx\n");
+	fprintf(translator->file, "\tmov rdx, rcx\n");
+	fprintf(translator->file, "\tsub rcx, 1\n");
+	fprintf(translator->file, "\tcmp rax, 9\n");
+	fprintf(translator->file, "\tja .L2\n");
+	fprintf(translator->file, "\tlea rax, [rsp + 32]\n");
+	fprintf(translator->file, "\tmov edi, 1\n");
+	fprintf(translator->file, "\tsub rdx, rax\n");
+	fprintf(translator->file, "\txor eax, eax\n");
+	fprintf(translator->file, "\tlea rsi, [rsp + 32 + rdx]\n");
+	fprintf(translator->file, "\tmov rdx, r8\n");
+	fprintf(translator->file, "\tmov rax, 1\n");
+	fprintf(translator->file, "\tsyscall\n");
+	fprintf(translator->file, "\tadd rsp, 40\n");
+	fprintf(translator->file, "\tret\n");
 #endif
 
-	for (struct LNode* proceduresIterator = globals->procedures.front; proceduresIterator != NULL; proceduresIterator = proceduresIterator->next)
-	{
-		// NOTE: using `assert` and not `if`
-		// REASONS:
-		//     1. The procedures iterator's data, in the list must never be of value
-		//        null.
-		//     2. This assert will prevent developers infliced bugs and development
-		//        and debug configuration.
-		assert(proceduresIterator->data != NULL);
+	return 1;
+}
 
-		struct Procedure* procedure = (struct Procedure*)proceduresIterator->data;
+void Translator_translateProcedure(
+	struct Translator* const translator,
+	const struct Globals* const globals,
+	const struct Procedure* const procedure)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The translator, provided to this function, must never ever be null, and must
+	//        be opened.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(translator != NULL && translator->file != NULL);
 
-		Translator_translateProcedure(file, procedure);
+	// Returning to the text, in case the data of the previous procedure's string literals was written
+	if (translator->isInData)
+	{
+		fprintf(translator->file, "\n");
+		fprintf(translator->file, "segment .text\n");
+		translator->isInData = 0;
 	}
 
-	fprintf(file, "\n");
-	fprintf(file, "segment .data\n");
-
-	for (struct LNode* stringsIterator = globals->stringLiterals.front; stringsIterator != NULL; stringsIterator = stringsIterator->next)
-	{
-		// NOTE: using `assert` and not `if`
-		// REASONS:
-		//     1. The strings iterator's data, in the list must never be of value
-		//        null.
-		//     2. This assert will prevent developers infliced bugs and development
-		//        and debug configuration.
-		assert(stringsIterator->data != NULL);
+	Translator_translateInstructions(translator->file, globals, procedure);
+}
 
-		struct Token* token = (struct Token*)stringsIterator->data;
+void Translator_translateStringLiterals(
+	struct Translator* const translator,
+	const struct Globals* const globals)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The translator, provided to this function, must never ever be null, and must
+	//        be opened.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(translator != NULL && translator->file != NULL);
 
-		fprintf(file, "\tstr_%s: db", hash256(token->source.buffer, token->source.length).stringified);
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The globals, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(globals != NULL);
 
-		for (int64_t i = 0; i < token->value.string.length; ++i)
-		{
-			fprintf(file, " %#02x", token->value.string.bytes[i]);
+	FILE* file = translator->file;
 
-			if (i < token->value.string.length - 1)
-			{
-				fprintf(file, ",");
-			}
-		}
+	if (translator->stringLiteralsCount >= globals->stringLiterals.count)
+	{
+		return;
+	}
 
+	if (!translator->isInData)
+	{
 		fprintf(file, "\n");
+		fprintf(file, "segment .data\n");
+		translator->isInData = 1;
+	}
+
+	for (int64_t index = translator->stringLiteralsCount; index < globals->stringLiterals.count; ++index)
+	{
+		const struct StringLiteral* stringLiteral = (const struct StringLiteral*)List_at(&globals->stringLiterals, index);
 
-		/*
-		signed char duplicate = 0;
-		struct Token* token = (struct Token*)stringsIterator->data;
+		fprintf(file, "\tstr_%ld: db", stringLiteral->index);
 
-		for (struct LNode* checkIterator = strings.front; checkIterator != stringsIterator; checkIterator = checkIterator->next)
+		// NOTE: `db` without operands is rejected by nasm, so an empty literal gets a zero byte,
+		//       that is never read, since the pushed length is 0.
+		if (stringLiteral->length <= 0)
 		{
-			// NOTE: using `assert` and not `if`
-			// REASONS:
-			//     1. The check iterator's data, in the list must never be of value
-			//        null.
-			//     2. This assert will prevent developers infliced bugs and development
-			//        and debug configuration.
-			assert(checkIterator->data != NULL);
+			fprintf(file, " 0");
+		}
 
-			struct Token* temp = (struct Token*)checkIterator->data;
+		for (int64_t i = 0; i < stringLiteral->length; ++i)
+		{
+			fprintf(file, " %#02x", stringLiteral->bytes[i]);
 
-			if (memcmp(token->source.buffer, temp->source.buffer, temp->source.length) == 0)
+			if (i < stringLiteral->length - 1)
 			{
-				duplicate = 1;
+				fprintf(file, ",");
 			}
 		}
-		*/
 
-		/*
-		if (!duplicate)
-		{
-			fprintf(file, "\tstr_%s: db", hash256(token->source.buffer, token->source.length).stringified);
+		fprintf(file, "\n");
+	}
 
-			for (int64_t i = 0; i < token->value.string.length; ++i)
-			{
-				fprintf(file, " %#02x", token->value.string.bytes[i]);
+	translator->stringLiteralsCount = globals->stringLiterals.count;
+}
 
-				if (i < token->value.string.length - 1)
-				{
-					fprintf(file, ",");
-				}
-			}
+void Translator_close(
+	struct Translator* const translator)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The translator, provided to this function, must never ever be null, and must
+	//        be opened.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(translator != NULL && translator->file != NULL);
 
-			fprintf(file, "\n");
-		}
-		*/
+	FILE* file = translator->file;
+
+	// The data segment is always present, even when no string literal was pooled
+	if (translator->stringLiteralsCount <= 0)
+	{
+		fprintf(file, "\n");
+		fprintf(file, "segment .data\n");
 	}
 
 	fprintf(file, "\n");
@@ -218,11 +290,13 @@ signed char Translator_translateTokens(
 	fprintf(file, "\tret_stack: resb %ld\n", RET_STACK_CAP);
 	fprintf(file, "\tret_stack_end:\n");
 
-	return 1;
+	fclose(file);
+	translator->file = NULL;
 }
 
-static void Translator_translateProcedure(
+static void Translator_translateInstructions(
 	FILE* const file,
+	const struct Globals* const globals,
 	const struct Procedure* const procedure)
 {
 	// NOTE: using `assert` and not `if`
@@ -232,6 +306,16 @@ static void Translator_translateProcedure(
 	//        and debug configuration.
 	assert(file != NULL);
 
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The globals, provided to this function, must never ever be null, and must have
+	//        the tokens.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(globals != NULL && globals->tokens != NULL);
+
+	const struct Tokens* tokens = globals->tokens;
+
 	// NOTE: using `assert` and not `if`
 	// REASONS:
 	//     1. The procedure, provided to this function, must never ever be null.
@@ -241,7 +325,7 @@ static void Translator_translateProcedure(
 
 	if (procedure->isMain)
 	{
-		fprintf(file, ";; -- %.*s -- \n", (signed int)procedure->name->source.length, procedure->name->source.buffer);
+		fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[procedure->name], Tokens_source(tokens, procedure->name));
 		fprintf(file, "global _start\n");
 		fprintf(file, "_start:\n");
 		fprintf(file, "\tmov [args_ptr], rsp\n");
@@ -250,125 +334,120 @@ static void Translator_translateProcedure(
 	}
 	else
 	{
-		fprintf(file, ";; -- %.*s -- \n", (signed int)procedure->name->source.length, procedure->name->source.buffer);
-		fprintf(file, "proc_%s:\n", hash256(procedure->name->source.buffer, procedure->name->source.length).stringified);
+		fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[procedure->name], Tokens_source(tokens, procedure->name));
+		fprintf(file, "proc_%ld:\n", procedure->index);
 		fprintf(file, "\tmov [ret_stack_rsp], rsp\n");
 		fprintf(file, "\tmov rsp, rax\n");
 	}
 
-	for (struct LNode* bodyIterator = procedure->body.front; bodyIterator != NULL; bodyIterator = bodyIterator->next)
+	for (int64_t index = 0; index < procedure->instructionsCount; ++index)
 	{
-		// NOTE: using `assert` and not `if`
-		// REASONS:
-		//     1. The procedures iterator's data, in the list must never be of value
-		//        null.
-		//     2. This assert will prevent developers infliced bugs and development
-		//        and debug configuration.
-		assert(bodyIterator->data != NULL);
-
-		struct Token* token = (struct Token*)bodyIterator->data;
-
-		switch (token->kind)
+		const struct Instruction* instruction = &procedure->instructions[index];
+		const int64_t token = (int64_t)instruction->token;
+		const int64_t label = (int64_t)tokens->offsets[token];
+
+		// NOTE: every instruction is labeled with its token's offset, so the labels stay unique
+		//       across the procedures (even when they are translated from different windows of
+		//       the tokens, see `Tokens_truncate`), and any instruction can be a jump target.
+		switch (instruction->opcode)
 		{
-			case TOKEN_IDENTIFIER:
+			case OPCODE_CALL:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tmov rax, rsp\n");
 				fprintf(file, "\tmov rsp, [ret_stack_rsp]\n");
-				fprintf(file, "\tcall proc_%s\n", hash256(token->source.buffer, token->source.length).stringified);
+				fprintf(file, "\tcall proc_%ld\n", instruction->operand);
 				fprintf(file, "\tmov [ret_stack_rsp], rsp\n");
 				fprintf(file, "\tmov rsp, rax\n");
 			} break;
 
-			case TOKEN_KEYWORD_IF:
-			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
-			} break;
-			
-			case TOKEN_KEYWORD_ELSE:
+			case OPCODE_JUMP:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 
 				// NOTES:
-				//     1. This should never ever be NULL. The cross reference is handled in parser and
-				//        must fail in case errors like this and neverr reach the translator!
+				//     1. This should never ever be invalid. The jumps are lowered by the parser
+				//        from the linked blocks and never reach the translator without
+				//        their targets!
 				//     2. Leaving the assert for development bugs.
-				assert(token->nextRef != NULL);
+				assert(instruction->target < procedure->instructionsCount);
 
-				fprintf(file, "\tjmp addr_%s\n", token->nextRef->hash.stringified);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, "\tjmp addr_%u\n", tokens->offsets[procedure->instructions[instruction->target].token]);
 			} break;
-			
-			case TOKEN_KEYWORD_WHILE:
-			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
-			} break;
-			
-			case TOKEN_KEYWORD_DO:
+
+			case OPCODE_JUMP_UNLESS:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 
 				fprintf(file, "\tpop rax\n");
 				fprintf(file, "\ttest rax, rax\n");
 
 				// NOTES:
-				//     1. This should never ever be NULL. The cross reference is handled in parser and
-				//        must fail in case errors like this and neverr reach the translator!
+				//     1. This should never ever be invalid. The jumps are lowered by the parser
+				//        from the linked blocks and never reach the translator without
+				//        their targets!
 				//     2. Leaving the assert for development bugs.
-				assert(token->nextRef != NULL);
+				assert(instruction->target < procedure->instructionsCount);
 
-				fprintf(file, "\tjz addr_%s\n", token->nextRef->hash.stringified);
+				fprintf(file, "\tjz addr_%u\n", tokens->offsets[procedure->instructions[instruction->target].token]);
 			} break;
 
-			case TOKEN_KEYWORD_END:
+			case OPCODE_RETURN:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
+				fprintf(file, "addr_%ld:\n", label);
 
-				if (token->nextRef != NULL) // while
+				if (procedure->isMain)
 				{
-					fprintf(file, "\tjmp addr_%s\n", token->nextRef->hash.stringified);
+					fprintf(file, ";; -- end -- \n");
+					fprintf(file, "\tmov rax, 60\n");
+					fprintf(file, "\tmov rdi, 0\n");
+					fprintf(file, "\tsyscall\n");
+				}
+				else
+				{
+					fprintf(file, "\tmov rax, rsp\n");
+					fprintf(file, "\tmov rsp, [ret_stack_rsp]\n");
+					fprintf(file, "\tret\n");
 				}
-
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
 			} break;
 
-			case TOKEN_INTRINSIC_ADD:
+			case OPCODE_ADD:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tpop rax\n");
 				fprintf(file, "\tpop rbx\n");
 				fprintf(file, "\tadd rax, rbx\n");
 				fprintf(file, "\tpush rax\n");
 			} break;
 
-			case TOKEN_INTRINSIC_SUBTRACT:
+			case OPCODE_SUBTRACT:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tpop rax\n");
 				fprintf(file, "\tpop rbx\n");
 				fprintf(file, "\tsub rbx, rax\n");
 				fprintf(file, "\tpush rbx\n");
 			} break;
 
-			case TOKEN_INTRINSIC_MULTIPLY:
+			case OPCODE_MULTIPLY:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tpop rax\n");
 				fprintf(file, "\tpop rbx\n");
 				fprintf(file, "\tmul rbx\n");
 				fprintf(file, "\tpush rax\n");
 			} break;
 
-			case TOKEN_INTRINSIC_DIVIDE:
+			case OPCODE_DIVIDE:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tpop rcx\n");
 				fprintf(file, "\tpop rax\n");
 				fprintf(file, "\tmov rdx, 0\n");
@@ -376,10 +455,10 @@ static void Translator_translateProcedure(
 				fprintf(file, "\tpush rax\n");
 			} break;
 
-			case TOKEN_INTRINSIC_MODULUS:
+			case OPCODE_MODULUS:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tpop rcx\n");
 				fprintf(file, "\tpop rax\n");
 				fprintf(file, "\tmov rdx, 0\n");
@@ -387,10 +466,10 @@ static void Translator_translateProcedure(
 				fprintf(file, "\tpush rdx\n");
 			} break;
 
-			case TOKEN_INTRINSIC_EQUAL:
+			case OPCODE_EQUAL:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tmov rcx, 0\n");
 				fprintf(file, "\tmov rdx, 1\n");
 				fprintf(file, "\tpop rax\n");
@@ -400,10 +479,10 @@ static void Translator_translateProcedure(
 				fprintf(file, "\tpush rcx\n");
 			} break;
 
-			case TOKEN_INTRINSIC_NEQUAL:
+			case OPCODE_NEQUAL:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tmov rcx, 1\n");
 				fprintf(file, "\tmov rdx, 0\n");
 				fprintf(file, "\tpop rax\n");
@@ -413,10 +492,10 @@ static void Translator_translateProcedure(
 				fprintf(file, "\tpush rcx\n");
 			} break;
 
-			case TOKEN_INTRINSIC_GREATER:
+			case OPCODE_GREATER:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tmov rcx, 0\n");
 				fprintf(file, "\tmov rdx, 1\n");
 				fprintf(file, "\tpop rbx\n");
@@ -426,10 +505,10 @@ static void Translator_translateProcedure(
 				fprintf(file, "\tpush rcx\n");
 			} break;
 
-			case TOKEN_INTRINSIC_LESS:
+			case OPCODE_LESS:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tmov rcx, 0\n");
 				fprintf(file, "\tmov rdx, 1\n");
 				fprintf(file, "\tpop rbx\n");
@@ -439,79 +518,79 @@ static void Translator_translateProcedure(
 				fprintf(file, "\tpush rcx\n");
 			} break;
 
-			case TOKEN_INTRINSIC_BAND:
+			case OPCODE_BAND:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tpop rax\n");
 				fprintf(file, "\tpop rbx\n");
 				fprintf(file, "\tand rbx, rax\n");
 				fprintf(file, "\tpush rbx\n");
 			} break;
 
-			case TOKEN_INTRINSIC_BOR:
+			case OPCODE_BOR:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tpop rax\n");
 				fprintf(file, "\tpop rbx\n");
 				fprintf(file, "\tor rbx, rax\n");
 				fprintf(file, "\tpush rbx\n");
 			} break;
 
-			case TOKEN_INTRINSIC_BNOT:
+			case OPCODE_BNOT:
 			{
 				// TODO: test it out!
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tmov eax, edi\n");
 				fprintf(file, "\tnot eax\n");
 				assert(!"FIXME: does not work!");
 			} break;
 
-			case TOKEN_INTRINSIC_SHIFTL:
+			case OPCODE_SHIFTL:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tpop rcx\n");
 				fprintf(file, "\tpop rbx\n");
 				fprintf(file, "\tshl rbx, cl\n");
 				fprintf(file, "\tpush rbx\n");
 			} break;
 
-			case TOKEN_INTRINSIC_SHIFTR:
+			case OPCODE_SHIFTR:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tpop rcx\n");
 				fprintf(file, "\tpop rbx\n");
 				fprintf(file, "\tshr rbx, cl\n");
 				fprintf(file, "\tpush rbx\n");
 			} break;
 
-			case TOKEN_INTRINSIC_SYSCALL0:
+			case OPCODE_SYSCALL0:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tpop rax\n");
 				fprintf(file, "\tsyscall\n");
 				fprintf(file, "\tpush rax\n");
 			} break;
 
-			case TOKEN_INTRINSIC_SYSCALL1:
+			case OPCODE_SYSCALL1:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tpop rax\n");
 				fprintf(file, "\tpop rdi\n");
 				fprintf(file, "\tsyscall\n");
 				fprintf(file, "\tpush rax\n");
 			} break;
 
-			case TOKEN_INTRINSIC_SYSCALL2:
+			case OPCODE_SYSCALL2:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tpop rax\n");
 				fprintf(file, "\tpop rdi\n");
 				fprintf(file, "\tpop rsi\n");
@@ -519,10 +598,10 @@ static void Translator_translateProcedure(
 				fprintf(file, "\tpush rax\n");
 			} break;
 
-			case TOKEN_INTRINSIC_SYSCALL3:
+			case OPCODE_SYSCALL3:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tpop rax\n");
 				fprintf(file, "\tpop rdi\n");
 				fprintf(file, "\tpop rsi\n");
@@ -531,10 +610,10 @@ static void Translator_translateProcedure(
 				fprintf(file, "\tpush rax\n");
 			} break;
 
-			case TOKEN_INTRINSIC_SYSCALL4:
+			case OPCODE_SYSCALL4:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tpop rax\n");
 				fprintf(file, "\tpop rdi\n");
 				fprintf(file, "\tpop rsi\n");
@@ -544,10 +623,10 @@ static void Translator_translateProcedure(
 				fprintf(file, "\tpush rax\n");
 			} break;
 
-			case TOKEN_INTRINSIC_SYSCALL5:
+			case OPCODE_SYSCALL5:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tpop rax\n");
 				fprintf(file, "\tpop rdi\n");
 				fprintf(file, "\tpop rsi\n");
@@ -558,10 +637,10 @@ static void Translator_translateProcedure(
 				fprintf(file, "\tpush rax\n");
 			} break;
 
-			case TOKEN_INTRINSIC_SYSCALL6:
+			case OPCODE_SYSCALL6:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tpop rax\n");
 				fprintf(file, "\tpop rdi\n");
 				fprintf(file, "\tpop rsi\n");
@@ -573,26 +652,26 @@ static void Translator_translateProcedure(
 				fprintf(file, "\tpush rax\n");
 			} break;
 
-			case TOKEN_INTRINSIC_CLONE:
+			case OPCODE_CLONE:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tpop rax\n");
 				fprintf(file, "\tpush rax\n");
 				fprintf(file, "\tpush rax\n");
 			} break;
 
-			case TOKEN_INTRINSIC_DROP:
+			case OPCODE_DROP:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tpop rax\n");
 			} break;
 
-			case TOKEN_INTRINSIC_OVER:
+			case OPCODE_OVER:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tpop rax\n");
 				fprintf(file, "\tpop rbx\n");
 				fprintf(file, "\tpush rbx\n");
@@ -602,44 +681,44 @@ static void Translator_translateProcedure(
 
 #if HIVEC_DEBUG
 // TODO: remove:
-			case TOKEN_INTRINSIC_PRINTN:
+			case OPCODE_PRINTN:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tpop rdi\n");
 				fprintf(file, "\tcall printn\n");
 			} break;
 #endif
 
-			case TOKEN_INTRINSIC_SWAP:
+			case OPCODE_SWAP:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 				fprintf(file, "\tpop rax\n");
 				fprintf(file, "\tpop rbx\n");
 				fprintf(file, "\tpush rax\n");
 				fprintf(file, "\tpush rbx\n");
 			} break;
 
-			case TOKEN_LITERAL_I64:
+			case OPCODE_PUSH_I64:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
-				fprintf(file, "\tmov rax, %ld\n", token->value.i64);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
+				fprintf(file, "\tmov rax, %ld\n", instruction->operand);
 				fprintf(file, "\tpush rax\n");
 			} break;
 
-			case TOKEN_LITERAL_STRING:
+			case OPCODE_PUSH_STRING:
 			{
-				fprintf(file, ";; -- %.*s -- \n", (signed int)token->source.length, token->source.buffer);
-				fprintf(file, "addr_%s:\n", token->hash.stringified);
+				fprintf(file, ";; -- %.*s -- \n", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+				fprintf(file, "addr_%ld:\n", label);
 
 				// Pushing string's length
-				fprintf(file, "\tmov rax, %ld\n", token->value.string.length);
+				fprintf(file, "\tmov rax, %ld\n", tokens->values[token].string.length);
 				fprintf(file, "\tpush rax\n");
 
 				// Pushing pointer to the string
-				fprintf(file, "\tpush str_%s\n", hash256(token->source.buffer, token->source.length).stringified);
+				fprintf(file, "\tpush str_%ld\n", instruction->operand);
 			} break;
 
 			default:
@@ -652,20 +731,6 @@ static void Translator_translateProcedure(
 			} break;
 		}
 	}
-
-	if (procedure->isMain)
-	{
-		fprintf(file, ";; -- end -- \n");
-		fprintf(file, "\tmov rax, 60\n");
-		fprintf(file, "\tmov rdi, 0\n");
-		fprintf(file, "\tsyscall\n");
-	}
-	else
-	{
-		fprintf(file, "\tmov rax, rsp\n");
-		fprintf(file, "\tmov rsp, [ret_stack_rsp]\n");
-		fprintf(file, "\tret\n");
-	}
 }
 
 /**
@@ -16,66 +16,105 @@
 #include <stdlib.h>
 #include <stdarg.h>
 #include <stdio.h>
+#include <string.h>
 
-struct Stack Stack_create(
+#ifdef WIN32
+// TODO: add equivalent of sys/mman.h!
+#	error "TODO: need to add equivalent of sys/mman.h!"
+#else
+#	include <sys/mman.h>
+#endif
+
+#define ARENA_MINIMAL_BLOCK_CAPACITY ((int64_t)(64 * 1024))
+#define ARENA_MAXIMAL_BLOCK_CAPACITY ((int64_t)(16 * 1024 * 1024))
+#define ARENA_ALIGNMENT ((int64_t)16)
+
+static void** Types_growElements(
+	struct Arena* const arena,
+	void** elements,
+	const int64_t count,
+	const int64_t capacity);
+
+static void Tokens_reserve(
+	struct Tokens* const tokens,
+	const int64_t count);
+
+static void* Types_growColumn(
+	struct Arena* const arena,
+	const void* column,
+	const int64_t count,
+	const int64_t elementSize,
+	const int64_t capacity);
+
+struct Arena Arena_create(
 	void)
 {
-	struct Stack stack = {0};
-	stack.top = NULL;
-	stack.count = 0;
-	return stack;
+	struct Arena arena = {0};
+	arena.top = NULL;
+	arena.blockCapacity = ARENA_MINIMAL_BLOCK_CAPACITY;
+	return arena;
 }
 
-void Stack_destroy(
-	struct Stack* const stack)
+void Arena_destroy(
+	struct Arena* const arena)
 {
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The stack, provided to this function, must never ever be null.
+	//     1. The arena, provided to this function, must never ever be null.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(stack != NULL);
+	assert(arena != NULL);
 
-	for (struct SNode* iterator = stack->top; iterator != NULL;)
+	for (struct ABlock* iterator = arena->top; iterator != NULL;)
 	{
-		struct SNode* current = iterator;
-
-		// NOTE: using `assert` and not `if`
-		// REASONS:
-		//     1. The current node, must never ever be null. The iterator, having
-		//        value of null, should necer enter the loop.
-		//     2. This assert will prevent developers infliced bugs and development
-		//        and debug configuration.
-		assert(current != NULL);
-
+		struct ABlock* current = iterator;
 		iterator = iterator->previous;
 		free(current);
 	}
 
-	stack->count = 0;
+	arena->top = NULL;
+	arena->blockCapacity = ARENA_MINIMAL_BLOCK_CAPACITY;
 }
 
-void Stack_push(
-	struct Stack* const stack,
-	void* data)
+void* Arena_allocate(
+	struct Arena* const arena,
+	const int64_t size)
 {
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The stack, provided to this function, must never ever be null.
+	//     1. The arena, provided to this function, must never ever be null.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(stack != NULL);
+	assert(arena != NULL);
 
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The data, provided to this function, must never ever be null.
+	//     1. Size must be positive or 0.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(data != NULL);
+	assert(size >= 0);
+
+	// Every allocation starts at an aligned offset, so any type can be placed into the arena
+	const int64_t alignedSize = (size + (ARENA_ALIGNMENT - 1)) & ~(ARENA_ALIGNMENT - 1);
+	struct ABlock* block = arena->top;
 
-	if (stack->top == NULL)
+	if (block == NULL || block->capacity - block->used < alignedSize)
 	{
-		stack->top = (struct SNode*)malloc(sizeof(struct SNode));
+		// NOTE: blocks grow geometrically, so big compilation units need only a handful of
+		//       them, while the small ones do not reserve much memory upfront.
+		int64_t capacity = arena->blockCapacity;
+
+		if (capacity < alignedSize)
+		{
+			capacity = alignedSize;
+		}
+
+		if (arena->blockCapacity < ARENA_MAXIMAL_BLOCK_CAPACITY)
+		{
+			arena->blockCapacity *= 2;
+		}
+
+		block = (struct ABlock*)malloc(sizeof(struct ABlock) + (size_t)capacity);
 
 		// NOTE: using `assert` and not `if`
 		// REASONS:
@@ -85,15 +124,69 @@ void Stack_push(
 		//        scenario - the compiler crashes, and user re-runs it.
 		//     2. This assert will prevent developers infliced bugs and development
 		//        and debug configuration.
-		assert(stack->top != NULL);
+		assert(block != NULL);
+
+		block->previous = arena->top;
+		block->capacity = capacity;
+		block->used = 0;
+		block->data = (unsigned char*)(block + 1);
+		arena->top = block;
+	}
+
+	void* data = block->data + block->used;
+	block->used += alignedSize;
+	return data;
+}
+
+void Arena_adopt(
+	struct Arena* const arena,
+	struct Arena* const other)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The arenas, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(arena != NULL && other != NULL);
 
-		struct SNode* node = stack->top;
-		node->data = data;
-		node->previous = NULL;
+	if (other->top == NULL)
+	{
+		return;
+	}
+
+	struct ABlock* bottom = other->top;
+
+	while (bottom->previous != NULL)
+	{
+		bottom = bottom->previous;
+	}
+
+	// NOTE: the adopted blocks are linked right below the top block, so the arena keeps
+	//       allocating from its own partially used block.
+	if (arena->top == NULL)
+	{
+		arena->top = other->top;
 	}
 	else
 	{
-		struct SNode* node = (struct SNode*)malloc(sizeof(struct SNode));
+		bottom->previous = arena->top->previous;
+		arena->top->previous = other->top;
+	}
+
+	other->top = NULL;
+	other->blockCapacity = ARENA_MINIMAL_BLOCK_CAPACITY;
+}
+
+static void** Types_growElements(
+	struct Arena* const arena,
+	void** elements,
+	const int64_t count,
+	const int64_t capacity)
+{
+	// NOTE: containers without an arena own their elements and free them on their own.
+	if (arena == NULL)
+	{
+		void** grown = (void**)realloc(elements, (size_t)capacity * sizeof(void*));
 
 		// NOTE: using `assert` and not `if`
 		// REASONS:
@@ -103,14 +196,84 @@ void Stack_push(
 		//        scenario - the compiler crashes, and user re-runs it.
 		//     2. This assert will prevent developers infliced bugs and development
 		//        and debug configuration.
-		assert(node != NULL);
+		assert(grown != NULL);
+
+		return grown;
+	}
 
-		node->data = data;
-		node->previous = stack->top;
-		stack->top = node;
+	return (void**)Types_growColumn(arena, elements, count, sizeof(void*), capacity);
+}
+
+struct Stack Stack_create(
+	struct Arena* const arena)
+{
+	struct Stack stack = {0};
+	stack.arena = arena;
+	stack.elements = NULL;
+	stack.count = 0;
+	stack.capacity = STACK_INLINE_CAPACITY;
+	return stack;
+}
+
+void Stack_destroy(
+	struct Stack* const stack)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The stack, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(stack != NULL);
+
+	// NOTE: elements, allocated in an arena, are released all at once with the arena.
+	if (stack->arena == NULL)
+	{
+		free(stack->elements);
+	}
+
+	stack->elements = NULL;
+	stack->count = 0;
+	stack->capacity = STACK_INLINE_CAPACITY;
+}
+
+void Stack_push(
+	struct Stack* const stack,
+	void* data)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The stack, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(stack != NULL);
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The data, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(data != NULL);
+
+	if (stack->count >= stack->capacity)
+	{
+		const int64_t capacity = stack->capacity * 2;
+
+		// Moving out of the inline elements, once they are exhausted
+		if (stack->elements == NULL)
+		{
+			stack->elements = Types_growElements(stack->arena, NULL, 0, capacity);
+			memcpy(stack->elements, stack->inlineElements, (size_t)stack->count * sizeof(void*));
+		}
+		else
+		{
+			stack->elements = Types_growElements(stack->arena, stack->elements, stack->count, capacity);
+		}
+
+		stack->capacity = capacity;
 	}
 
-	++stack->count;
+	void** elements = stack->elements != NULL ? stack->elements : stack->inlineElements;
+	elements[stack->count++] = data;
 }
 
 void* Stack_pop(
@@ -123,17 +286,13 @@ void* Stack_pop(
 	//        and debug configuration.
 	assert(stack != NULL);
 
-	if (stack->top == NULL)
+	if (stack->count <= 0)
 	{
 		return NULL;
 	}
 
-	struct SNode* node = stack->top;
-	stack->top = node->previous;
-	void* data = node->data;
-	free(node);
-	--stack->count;
-	return data;
+	void** elements = stack->elements != NULL ? stack->elements : stack->inlineElements;
+	return elements[--stack->count];
 }
 
 void* Stack_peek(
@@ -149,10 +308,10 @@ void* Stack_peek(
 
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. An element should never be popped from an empty stack.
+	//     1. An element should never be peeked from an empty stack.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(stack->top != NULL);
+	assert(stack->count > 0);
 
 	// NOTE: using `assert` and not `if`
 	// REASONS:
@@ -166,25 +325,21 @@ void* Stack_peek(
 	//     1. Offset must not go over the count of the stack.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(stack->count - offset >= 0);
-
-	struct SNode* node = stack->top;
+	assert(offset < stack->count);
 
-	for (int64_t index = 0; index < offset; ++index)
-	{
-		node = node->previous;
-	}
-
-	void* data = node->data;
-	return data;
+	void** elements = stack->elements != NULL ? stack->elements : stack->inlineElements;
+	return elements[stack->count - 1 - offset];
 }
 
 struct Queue Queue_create(
-	void)
+	struct Arena* const arena)
 {
 	struct Queue queue = {0};
-	queue.front = NULL;
-	queue.back = NULL;
+	queue.arena = arena;
+	queue.elements = NULL;
+	queue.front = 0;
+	queue.count = 0;
+	queue.capacity = 0;
 	return queue;
 }
 
@@ -198,23 +353,16 @@ void Queue_destroy(
 	//        and debug configuration.
 	assert(queue != NULL);
 
-	for (struct QNode* iterator = queue->front; iterator != NULL;)
+	// NOTE: elements, allocated in an arena, are released all at once with the arena.
+	if (queue->arena == NULL)
 	{
-		struct QNode* current = iterator;
-
-		// NOTE: using `assert` and not `if`
-		// REASONS:
-		//     1. The current node, must never ever be null. The iterator, having
-		//        value of null, should necer enter the loop.
-		//     2. This assert will prevent developers infliced bugs and development
-		//        and debug configuration.
-		assert(current != NULL);
-
-		iterator = iterator->next;
-		free(current);
+		free(queue->elements);
 	}
 
+	queue->elements = NULL;
+	queue->front = 0;
 	queue->count = 0;
+	queue->capacity = 0;
 }
 
 void Queue_enqueue(
@@ -235,45 +383,22 @@ void Queue_enqueue(
 	//        and debug configuration.
 	assert(data != NULL);
 
-	if (queue->front == NULL)
+	if (queue->count >= queue->capacity)
 	{
-		queue->back = (struct QNode*)malloc(sizeof(struct QNode));
+		const int64_t capacity = queue->capacity > 0 ? queue->capacity * 2 : CONTAINER_MINIMAL_CAPACITY;
+		queue->elements = Types_growElements(queue->arena, queue->elements, queue->capacity, capacity);
 
-		// NOTE: using `assert` and not `if`
-		// REASONS:
-		//     1. The memory allocation errors can happen anytime, no matter build
-		//        configuration being debug or release. However, since the compiler
-		//        cannot prevent such bugs, I will leave it as assert. Worst case
-		//        scenario - the compiler crashes, and user re-runs it.
-		//     2. This assert will prevent developers infliced bugs and development
-		//        and debug configuration.
-		assert(queue->back != NULL);
-
-		struct QNode* node = queue->back;
-		node->data = data;
-		node->next = NULL;
-		queue->front = queue->back;
-	}
-	else
-	{
-		struct QNode* node = (struct QNode*)malloc(sizeof(struct QNode));
-
-		// NOTE: using `assert` and not `if`
-		// REASONS:
-		//     1. The memory allocation errors can happen anytime, no matter build
-		//        configuration being debug or release. However, since the compiler
-		//        cannot prevent such bugs, I will leave it as assert. Worst case
-		//        scenario - the compiler crashes, and user re-runs it.
-		//     2. This assert will prevent developers infliced bugs and development
-		//        and debug configuration.
-		assert(node != NULL);
+		// NOTE: the full ring wraps around right before the front element, so its wrapped part
+		//       is moved after the old end, where the doubled array has room for all of it.
+		if (queue->front > 0)
+		{
+			memcpy(queue->elements + queue->capacity, queue->elements, (size_t)queue->front * sizeof(void*));
+		}
 
-		node->data = data;
-		node->next = NULL;
-		queue->back->next = node;
-		queue->back = node;
+		queue->capacity = capacity;
 	}
 
+	queue->elements[(queue->front + queue->count) & (queue->capacity - 1)] = data;
 	++queue->count;
 }
 
@@ -287,15 +412,13 @@ void* Queue_dequeue(
 	//        and debug configuration.
 	assert(queue != NULL);
 
-	if (queue->front == NULL)
+	if (queue->count <= 0)
 	{
 		return NULL;
 	}
 
-	struct QNode* node = queue->front;
-	queue->front = node->next;
-	void* data = node->data;
-	free(node);
+	void* data = queue->elements[queue->front];
+	queue->front = (queue->front + 1) & (queue->capacity - 1);
 	--queue->count;
 	return data;
 }
@@ -312,22 +435,22 @@ void* Queue_peek(
 
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. An element should never be dequeued from an empty queue.
+	//     1. An element should never be peeked from an empty queue.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(queue->front != NULL);
+	assert(queue->count > 0);
 
-	struct QNode* node = queue->front;
-	void* data = node->data;
-	return data;
+	return queue->elements[queue->front];
 }
 
 struct List List_create(
-	void)
+	struct Arena* const arena)
 {
 	struct List list = {0};
-	list.front = NULL;
-	list.back = NULL;
+	list.arena = arena;
+	list.elements = NULL;
+	list.count = 0;
+	list.capacity = 0;
 	return list;
 }
 
@@ -341,23 +464,15 @@ void List_destroy(
 	//        and debug configuration.
 	assert(list != NULL);
 
-	for (struct LNode* iterator = list->front; iterator != NULL;)
+	// NOTE: elements, allocated in an arena, are released all at once with the arena.
+	if (list->arena == NULL)
 	{
-		struct LNode* current = iterator;
-
-		// NOTE: using `assert` and not `if`
-		// REASONS:
-		//     1. The current node, must never ever be null. The iterator, having
-		//        value of null, should necer enter the loop.
-		//     2. This assert will prevent developers infliced bugs and development
-		//        and debug configuration.
-		assert(current != NULL);
-
-		iterator = iterator->next;
-		free(current);
+		free(list->elements);
 	}
 
+	list->elements = NULL;
 	list->count = 0;
+	list->capacity = 0;
 }
 
 void List_push(
@@ -378,46 +493,35 @@ void List_push(
 	//        and debug configuration.
 	assert(data != NULL);
 
-	if (list->front == NULL)
+	if (list->count >= list->capacity)
 	{
-		list->back = (struct LNode*)malloc(sizeof(struct LNode));
-
-		// NOTE: using `assert` and not `if`
-		// REASONS:
-		//     1. The memory allocation errors can happen anytime, no matter build
-		//        configuration being debug or release. However, since the compiler
-		//        cannot prevent such bugs, I will leave it as assert. Worst case
-		//        scenario - the compiler crashes, and user re-runs it.
-		//     2. This assert will prevent developers infliced bugs and development
-		//        and debug configuration.
-		assert(list->back != NULL);
-
-		struct LNode* node = list->back;
-		node->data = data;
-		node->next = NULL;
-		list->front = list->back;
+		const int64_t capacity = list->capacity > 0 ? list->capacity * 2 : CONTAINER_MINIMAL_CAPACITY;
+		list->elements = Types_growElements(list->arena, list->elements, list->count, capacity);
+		list->capacity = capacity;
 	}
-	else
-	{
-		struct LNode* node = (struct LNode*)malloc(sizeof(struct LNode));
 
-		// NOTE: using `assert` and not `if`
-		// REASONS:
-		//     1. The memory allocation errors can happen anytime, no matter build
-		//        configuration being debug or release. However, since the compiler
-		//        cannot prevent such bugs, I will leave it as assert. Worst case
-		//        scenario - the compiler crashes, and user re-runs it.
-		//     2. This assert will prevent developers infliced bugs and development
-		//        and debug configuration.
-		assert(node != NULL);
+	list->elements[list->count++] = data;
+}
 
-		node->data = data;
-		node->next = NULL;
-		list->back->next = node;
-		list->back = node;
-	}
+void* List_at(
+	const struct List* const list,
+	const int64_t index)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The list, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(list != NULL);
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The index must be a valid index into the list.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(index >= 0 && index < list->count);
 
-	++list->count;
+	return list->elements[index];
 }
 
 signed char List_exists(
@@ -438,17 +542,9 @@ signed char List_exists(
 	//        and debug configuration.
 	assert(data != NULL);
 
-	for (struct LNode* iterator = list->front; iterator != NULL; iterator = iterator->next)
+	for (int64_t index = 0; index < list->count; ++index)
 	{
-		// NOTE: using `assert` and not `if`
-		// REASONS:
-		//     1. The data of the iterator in the list must never be of value null,
-		//        since the sources were already checked.
-		//     2. This assert will prevent developers infliced bugs and development
-		//        and debug configuration.
-		assert(iterator->data != NULL);
-
-		if (data == iterator->data)
+		if (data == list->elements[index])
 		{
 			return 1;
 		}
@@ -480,76 +576,582 @@ signed char Location_isInvalid(
 	return location->file == NULL && location->line == -1 && location->column == -1;
 }
 
-void Token_destroy(
-	struct Token* const token)
+struct Source Source_create(
+	const char* file)
 {
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The token, provided to this function, must never ever be null.
+	//     1. The file, provided to this function, must never ever be null.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(token != NULL);
+	assert(file != NULL);
+
+	struct Source source = {0};
+	source.file = file;
+	source.buffer = NULL;
+	source.length = 0;
+	source.isMapped = 0;
+	source.cache = NULL;
+	source.cacheLength = 0;
+	source.lineStarts = NULL;
+	source.linesCount = 0;
+	return source;
+}
+
+struct Location Source_locate(
+	struct Source* const source,
+	const int64_t offset)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The source, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(source != NULL);
 
-	switch (token->kind)
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The offset must point into the buffer of the source (or right past its end).
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(offset >= 0 && offset <= source->length);
+
+	// NOTE: the lines index is built once, by the first diagnostic of the source. It is not
+	//       synchronized, the multi-threaded passes build it up front.
+	Source_indexLines(source);
+
+	// Searching for the last line, that starts at or before the offset
+	int64_t low = 0;
+	int64_t high = source->linesCount - 1;
+
+	while (low < high)
 	{
-		case TOKEN_LITERAL_STRING:
+		const int64_t middle = low + (high - low + 1) / 2;
+
+		if (source->lineStarts[middle] <= offset)
 		{
-			free(token->value.string.bytes);
-		} break;
-	
-		default:
+			low = middle;
+		}
+		else
 		{
-		} break;
+			high = middle - 1;
+		}
 	}
 
-	free(token->source.buffer);
-	free(token);
+	struct Location location = {0};
+	location.file = source->file;
+	location.line = low + 1;
+	location.column = offset - source->lineStarts[low] + 1;
+	return location;
 }
 
-const char* Token_stringify(
-	const struct Token* const token)
+void Source_indexLines(
+	struct Source* const source)
 {
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The token, provided to this function, must never ever be null.
+	//     1. The source, provided to this function, must never ever be null.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(token != NULL);
+	assert(source != NULL);
 
-	// NOTE: this `stringifiedTokensKindsCount` define must be changed when modifying the `stringifiedTokensKinds` set!
-#if HIVEC_DEBUG
-// TODO: remove:
-	#define stringifiedTokensKindsCount ((int64_t)42)
-#else
-	#define stringifiedTokensKindsCount ((int64_t)41)
-#endif
-	static const char* stringifiedTokensKinds[] =
+	if (source->lineStarts != NULL)
 	{
-		[TOKEN_INVALID] = "invalid",
-		[TOKEN_IDENTIFIER] = "identifier",
+		return;
+	}
 
-		[TOKEN_KEYWORD_MAIN] = "keyword_main",
-		[TOKEN_KEYWORD_I64] = "keyword_i64",
-		[TOKEN_KEYWORD_P64] = "keyword_p64",
-		[TOKEN_KEYWORD_IF] = "keyword_if",
-		[TOKEN_KEYWORD_ELSE] = "keyword_else",
-		[TOKEN_KEYWORD_WHILE] = "keyword_while",
-		[TOKEN_KEYWORD_PROCEDURE] = "keyword_procedure",
-		[TOKEN_KEYWORD_REQUIRE] = "keyword_require",
-		[TOKEN_KEYWORD_RETURN] = "keyword_return",
-		[TOKEN_KEYWORD_DO] = "keyword_do",
-		[TOKEN_KEYWORD_END] = "keyword_end",
+	int64_t linesCount = 1;
 
-		[TOKEN_INTRINSIC_ADD] = "intrinsic_add",
-		[TOKEN_INTRINSIC_SUBTRACT] = "intrinsic_subtract",
-		[TOKEN_INTRINSIC_MULTIPLY] = "intrinsic_multiplly",
-		[TOKEN_INTRINSIC_DIVIDE] = "intrinsic_divide",
-		[TOKEN_INTRINSIC_MODULUS] = "intrinsic_modulus",
-		[TOKEN_INTRINSIC_EQUAL] = "intrinsic_equal",
-		[TOKEN_INTRINSIC_NEQUAL] = "intrinsic_nequal",
-		[TOKEN_INTRINSIC_GREATER] = "intrinsic_greater",
-		[TOKEN_INTRINSIC_LESS] = "intrinsic_less",
-		[TOKEN_INTRINSIC_BAND] = "intrinsic_band",
+	for (const char* iterator = source->buffer, * end = source->buffer + source->length;
+		iterator < end && (iterator = (const char*)memchr(iterator, '\n', (size_t)(end - iterator))) != NULL; ++iterator)
+	{
+		++linesCount;
+	}
+
+	source->lineStarts = (int64_t*)malloc((size_t)linesCount * sizeof(int64_t));
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The memory allocation errors can happen anytime, no matter build
+	//        configuration being debug or release. However, since the compiler
+	//        cannot prevent such bugs, I will leave it as assert. Worst case
+	//        scenario - the compiler crashes, and user re-runs it.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(source->lineStarts != NULL);
+
+	source->lineStarts[0] = 0;
+	source->linesCount = 1;
+
+	for (const char* iterator = source->buffer, * end = source->buffer + source->length;
+		iterator < end && (iterator = (const char*)memchr(iterator, '\n', (size_t)(end - iterator))) != NULL; ++iterator)
+	{
+		source->lineStarts[source->linesCount++] = iterator + 1 - source->buffer;
+	}
+}
+
+void Source_destroy(
+	struct Source* const source)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The source, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(source != NULL);
+
+	if (source->buffer != NULL)
+	{
+		if (source->isMapped)
+		{
+			munmap(source->buffer, (size_t)source->length);
+		}
+		else
+		{
+			free(source->buffer);
+		}
+	}
+
+	if (source->cache != NULL)
+	{
+		munmap(source->cache, (size_t)source->cacheLength);
+	}
+
+	source->buffer = NULL;
+	source->length = 0;
+	source->isMapped = 0;
+	free(source->lineStarts);
+
+	source->cache = NULL;
+	source->cacheLength = 0;
+	source->lineStarts = NULL;
+	source->linesCount = 0;
+}
+
+#define SYMBOLS_MINIMAL_CAPACITY ((int64_t)256)
+
+static uint64_t Symbols_hash(
+	const char* const text,
+	const int64_t length);
+
+static void Symbols_rehash(
+	struct Symbols* const symbols,
+	const int64_t slotsCapacity);
+
+struct Symbols Symbols_create(
+	struct Arena* const arena)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The arena, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(arena != NULL);
+
+	struct Symbols symbols = {0};
+	symbols.arena = arena;
+	symbols.count = 0;
+	symbols.capacity = 0;
+	symbols.slotsCapacity = 0;
+	return symbols;
+}
+
+int64_t Symbols_intern(
+	struct Symbols* const symbols,
+	const char* const text,
+	const int64_t length)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The symbols, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(symbols != NULL);
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The text, provided to this function, must never ever be null, and its
+	//        length must be positive or 0.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(text != NULL && length >= 0);
+
+	// Keeping the table at most half full, so the probe sequences stay short
+	if ((symbols->count + 1) * 2 > symbols->slotsCapacity)
+	{
+		Symbols_rehash(symbols, symbols->slotsCapacity > 0 ? symbols->slotsCapacity * 2 : SYMBOLS_MINIMAL_CAPACITY);
+	}
+
+	const uint64_t hash = Symbols_hash(text, length);
+	const uint64_t mask = (uint64_t)symbols->slotsCapacity - 1;
+
+	for (uint64_t slot = hash & mask;; slot = (slot + 1) & mask)
+	{
+		const int64_t symbol = symbols->slots[slot];
+
+		if (symbol == INVALID_SYMBOL)
+		{
+			if (symbols->count >= symbols->capacity)
+			{
+				const int64_t capacity = symbols->capacity > 0 ? symbols->capacity * 2 : SYMBOLS_MINIMAL_CAPACITY;
+				symbols->texts = (const char**)Types_growColumn(symbols->arena, symbols->texts, symbols->count, sizeof(*symbols->texts), capacity);
+				symbols->lengths = (int64_t*)Types_growColumn(symbols->arena, symbols->lengths, symbols->count, sizeof(*symbols->lengths), capacity);
+				symbols->hashes = (uint64_t*)Types_growColumn(symbols->arena, symbols->hashes, symbols->count, sizeof(*symbols->hashes), capacity);
+				symbols->capacity = capacity;
+			}
+
+			const int64_t id = symbols->count++;
+			symbols->texts[id] = text;
+			symbols->lengths[id] = length;
+			symbols->hashes[id] = hash;
+			symbols->slots[slot] = id;
+			return id;
+		}
+
+		if (symbols->hashes[symbol] == hash
+		 && symbols->lengths[symbol] == length
+		 && memcmp(symbols->texts[symbol], text, (size_t)length) == 0)
+		{
+			return symbol;
+		}
+	}
+}
+
+static uint64_t Symbols_hash(
+	const char* const text,
+	const int64_t length)
+{
+	// NOTE: FNV-1a, symbols are short, so a simple byte-wise hash is the fastest here.
+	uint64_t hash = (uint64_t)14695981039346656037ULL;
+
+	for (int64_t i = 0; i < length; ++i)
+	{
+		hash ^= (uint64_t)(unsigned char)text[i];
+		hash *= (uint64_t)1099511628211ULL;
+	}
+
+	return hash;
+}
+
+static void Symbols_rehash(
+	struct Symbols* const symbols,
+	const int64_t slotsCapacity)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The symbols, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(symbols != NULL);
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The slots capacity must be a power of 2, the slots are picked with a mask.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(slotsCapacity > 0 && (slotsCapacity & (slotsCapacity - 1)) == 0);
+
+	symbols->slots = (int64_t*)Arena_allocate(symbols->arena, slotsCapacity * (int64_t)sizeof(int64_t));
+	symbols->slotsCapacity = slotsCapacity;
+	const uint64_t mask = (uint64_t)slotsCapacity - 1;
+
+	for (int64_t slot = 0; slot < slotsCapacity; ++slot)
+	{
+		symbols->slots[slot] = INVALID_SYMBOL;
+	}
+
+	for (int64_t symbol = 0; symbol < symbols->count; ++symbol)
+	{
+		uint64_t slot = symbols->hashes[symbol] & mask;
+
+		while (symbols->slots[slot] != INVALID_SYMBOL)
+		{
+			slot = (slot + 1) & mask;
+		}
+
+		symbols->slots[slot] = symbol;
+	}
+}
+
+#define TOKENS_MINIMAL_CAPACITY ((int64_t)1024)
+
+struct Tokens Tokens_create(
+	struct Arena* const arena,
+	struct Source* const source)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The arena, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(arena != NULL);
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The source, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(source != NULL);
+
+	struct Tokens tokens = {0};
+	tokens.arena = arena;
+	tokens.source = source;
+	tokens.count = 0;
+	tokens.capacity = 0;
+	tokens.symbols = Symbols_create(arena);
+	return tokens;
+}
+
+int64_t Tokens_push(
+	struct Tokens* const tokens,
+	const struct Token* const token)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The tokens, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(tokens != NULL);
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The token, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(token != NULL);
+
+	static_assert(TOKENS_COUNT <= 256, "Token kinds do not fit into the byte-sized kinds column anymore!");
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The token must point into the source, which the lexer refuses to lex when it is
+	//        longer than the 32-bit offsets can address.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(token->source.buffer >= tokens->source->buffer
+		&& token->source.buffer - tokens->source->buffer <= TOKENS_MAXIMAL_SOURCE_LENGTH);
+
+	if (tokens->count >= tokens->capacity)
+	{
+		Tokens_reserve(tokens, tokens->count + 1);
+	}
+
+	const int64_t id = tokens->count++;
+	tokens->kinds[id] = (unsigned char)token->kind;
+	tokens->values[id] = token->value;
+	tokens->offsets[id] = (uint32_t)(token->source.buffer - tokens->source->buffer);
+	tokens->lengths[id] = token->source.length;
+	tokens->symbolIds[id] = INVALID_SYMBOL;
+	tokens->nextRefs[id] = INVALID_TOKEN;
+	tokens->previousRefs[id] = INVALID_TOKEN;
+
+	return id;
+}
+
+void Tokens_append(
+	struct Tokens* const tokens,
+	const struct Tokens* const other)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The tokens, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(tokens != NULL);
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The other tokens, provided to this function, must never ever be null and
+	//        must be of the same source, since the offsets point into its buffer.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(other != NULL && other->source == tokens->source);
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The symbols are interned once the whole stream is stitched, so the other stream
+	//        must have none, otherwise its symbol ids would have to be remapped.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(other->symbols.count == 0);
+
+	if (other->count <= 0)
+	{
+		return;
+	}
+
+	Tokens_reserve(tokens, tokens->count + other->count);
+
+	const int64_t base = tokens->count;
+	memcpy(tokens->kinds + base, other->kinds, (size_t)other->count * sizeof(*tokens->kinds));
+	memcpy(tokens->values + base, other->values, (size_t)other->count * sizeof(*tokens->values));
+	memcpy(tokens->offsets + base, other->offsets, (size_t)other->count * sizeof(*tokens->offsets));
+	memcpy(tokens->lengths + base, other->lengths, (size_t)other->count * sizeof(*tokens->lengths));
+
+	for (int64_t token = 0; token < other->count; ++token)
+	{
+		tokens->symbolIds[base + token] = INVALID_SYMBOL;
+		tokens->nextRefs[base + token] = other->nextRefs[token] != INVALID_TOKEN ? other->nextRefs[token] + base : INVALID_TOKEN;
+		tokens->previousRefs[base + token] = other->previousRefs[token] != INVALID_TOKEN ? other->previousRefs[token] + base : INVALID_TOKEN;
+	}
+
+	tokens->count += other->count;
+}
+
+void Tokens_truncate(
+	struct Tokens* const tokens,
+	const int64_t count)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The tokens, provided to this function, must never ever be null, and can only
+	//        be shortened.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(tokens != NULL && count >= 0 && count <= tokens->count);
+
+	tokens->count = count;
+}
+
+const char* Tokens_source(
+	const struct Tokens* const tokens,
+	const int64_t token)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The tokens, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(tokens != NULL);
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The token id must be a valid index into the stream.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(token >= 0 && token < tokens->count);
+
+	return tokens->source->buffer + tokens->offsets[token];
+}
+
+struct Location Tokens_location(
+	const struct Tokens* const tokens,
+	const int64_t token)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The tokens, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(tokens != NULL);
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The token id must be a valid index into the stream.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(token >= 0 && token < tokens->count);
+
+	return Source_locate(tokens->source, (int64_t)tokens->offsets[token]);
+}
+
+static void Tokens_reserve(
+	struct Tokens* const tokens,
+	const int64_t count)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The tokens, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(tokens != NULL);
+
+	if (count <= tokens->capacity)
+	{
+		return;
+	}
+
+	// NOTE: the columns grow geometrically inside the arena. The old columns stay there
+	//       until the arena is destroyed, which at most doubles the memory of the stream.
+	int64_t capacity = tokens->capacity > 0 ? tokens->capacity * 2 : TOKENS_MINIMAL_CAPACITY;
+
+	if (capacity < count)
+	{
+		capacity = count;
+	}
+
+	tokens->kinds = (unsigned char*)Types_growColumn(tokens->arena, tokens->kinds, tokens->count, sizeof(*tokens->kinds), capacity);
+	tokens->values = (union TokenValue*)Types_growColumn(tokens->arena, tokens->values, tokens->count, sizeof(*tokens->values), capacity);
+	tokens->offsets = (uint32_t*)Types_growColumn(tokens->arena, tokens->offsets, tokens->count, sizeof(*tokens->offsets), capacity);
+	tokens->lengths = (int64_t*)Types_growColumn(tokens->arena, tokens->lengths, tokens->count, sizeof(*tokens->lengths), capacity);
+	tokens->symbolIds = (int64_t*)Types_growColumn(tokens->arena, tokens->symbolIds, tokens->count, sizeof(*tokens->symbolIds), capacity);
+	tokens->nextRefs = (int64_t*)Types_growColumn(tokens->arena, tokens->nextRefs, tokens->count, sizeof(*tokens->nextRefs), capacity);
+	tokens->previousRefs = (int64_t*)Types_growColumn(tokens->arena, tokens->previousRefs, tokens->count, sizeof(*tokens->previousRefs), capacity);
+	tokens->capacity = capacity;
+}
+
+static void* Types_growColumn(
+	struct Arena* const arena,
+	const void* column,
+	const int64_t count,
+	const int64_t elementSize,
+	const int64_t capacity)
+{
+	void* grown = Arena_allocate(arena, capacity * elementSize);
+
+	if (count > 0)
+	{
+		memcpy(grown, column, (size_t)(count * elementSize));
+	}
+
+	return grown;
+}
+
+const char* Tokens_stringify(
+	const struct Tokens* const tokens,
+	const int64_t token)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The tokens, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(tokens != NULL);
+
+	// NOTE: this `stringifiedTokensKindsCount` define must be changed when modifying the `stringifiedTokensKinds` set!
+#if HIVEC_DEBUG
+// TODO: remove:
+	#define stringifiedTokensKindsCount ((int64_t)42)
+#else
+	#define stringifiedTokensKindsCount ((int64_t)41)
+#endif
+	static const char* stringifiedTokensKinds[] =
+	{
+		[TOKEN_INVALID] = "invalid",
+		[TOKEN_IDENTIFIER] = "identifier",
+
+		[TOKEN_KEYWORD_MAIN] = "keyword_main",
+		[TOKEN_KEYWORD_I64] = "keyword_i64",
+		[TOKEN_KEYWORD_P64] = "keyword_p64",
+		[TOKEN_KEYWORD_IF] = "keyword_if",
+		[TOKEN_KEYWORD_ELSE] = "keyword_else",
+		[TOKEN_KEYWORD_WHILE] = "keyword_while",
+		[TOKEN_KEYWORD_PROCEDURE] = "keyword_procedure",
+		[TOKEN_KEYWORD_REQUIRE] = "keyword_require",
+		[TOKEN_KEYWORD_RETURN] = "keyword_return",
+		[TOKEN_KEYWORD_DO] = "keyword_do",
+		[TOKEN_KEYWORD_END] = "keyword_end",
+
+		[TOKEN_INTRINSIC_ADD] = "intrinsic_add",
+		[TOKEN_INTRINSIC_SUBTRACT] = "intrinsic_subtract",
+		[TOKEN_INTRINSIC_MULTIPLY] = "intrinsic_multiplly",
+		[TOKEN_INTRINSIC_DIVIDE] = "intrinsic_divide",
+		[TOKEN_INTRINSIC_MODULUS] = "intrinsic_modulus",
+		[TOKEN_INTRINSIC_EQUAL] = "intrinsic_equal",
+		[TOKEN_INTRINSIC_NEQUAL] = "intrinsic_nequal",
+		[TOKEN_INTRINSIC_GREATER] = "intrinsic_greater",
+		[TOKEN_INTRINSIC_LESS] = "intrinsic_less",
+		[TOKEN_INTRINSIC_BAND] = "intrinsic_band",
 		[TOKEN_INTRINSIC_BOR] = "intrinsic_bor",
 		[TOKEN_INTRINSIC_BNOT] = "intrinsic_bnot",
 		[TOKEN_INTRINSIC_SHIFTL] = "intrinsic_shiftl",
@@ -578,46 +1180,54 @@ const char* Token_stringify(
 	static_assert(TOKENS_COUNT == stringifiedTokensKindsCount,
 		"Stringified token kinds are out of sync with the kinds enum!");
 
-	assert((long unsigned int)(token->kind) < (sizeof(stringifiedTokensKinds) / sizeof(const char*)));
+	assert((long unsigned int)(tokens->kinds[token]) < (sizeof(stringifiedTokensKinds) / sizeof(const char*)));
 	#define bufferCapcity ((signed int)1024)
 	static char buffer[bufferCapcity];
 
 	snprintf(buffer, bufferCapcity, "id=`%ld` kind=`%s` source=`%.*s` location=`%s`",
-		token->id,
-		stringifiedTokensKinds[token->kind],
-		(int)token->source.length, token->source.buffer,
-		Location_stringify(token->location));
+		token,
+		stringifiedTokensKinds[tokens->kinds[token]],
+		(int)tokens->lengths[token], Tokens_source(tokens, token),
+		Location_stringify(Tokens_location(tokens, token)));
 
 	#undef bufferCapcity
 	return buffer;
 }
 
 struct Procedure* Procedure_create(
-	void)
+	struct Arena* const arena)
 {
-	struct Procedure* procedure = (struct Procedure*)malloc(sizeof(struct Procedure));
-
 	// NOTE: using `assert` and not `if`
 	// REASONS:
-	//     1. The memory allocation errors can happen anytime, no matter build
-	//        configuration being debug or release. However, since the compiler
-	//        cannot prevent such bugs, I will leave it as assert. Worst case
-	//        scenario - the compiler crashes, and user re-runs it.
+	//     1. The arena, provided to this function, must never ever be null.
 	//     2. This assert will prevent developers infliced bugs and development
 	//        and debug configuration.
-	assert(procedure != NULL);
-
-	procedure->name = NULL;
-	procedure->requiredTypes = List_create();
-	procedure->returnedTypes = List_create();
-	procedure->body = List_create();
+	assert(arena != NULL);
+
+	struct Procedure* procedure = (struct Procedure*)Arena_allocate(arena, sizeof(struct Procedure));
+	procedure->name = INVALID_TOKEN;
+	procedure->index = INVALID_PROCEDURE;
+	procedure->requiredTypes = (struct TokensRange) { .begin = 0, .end = 0 };
+	procedure->returnedTypes = (struct TokensRange) { .begin = 0, .end = 0 };
+	procedure->body = (struct TokensRange) { .begin = 0, .end = 0 };
 	procedure->isMain = 0;
+	procedure->instructions = NULL;
+	procedure->instructionsCount = 0;
+	procedure->stackDepth = 0;
 	return procedure;
 }
 
-void Procedure_destroy(
-	struct Procedure* const procedure)
+void Procedure_print(
+	const struct Tokens* const tokens,
+	const struct Procedure* const procedure)
 {
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The tokens, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(tokens != NULL);
+
 	// NOTE: using `assert` and not `if`
 	// REASONS:
 	//     1. The procedure, provided to this function, must never ever be null.
@@ -625,15 +1235,88 @@ void Procedure_destroy(
 	//        and debug configuration.
 	assert(procedure != NULL);
 
-	List_destroy(&procedure->requiredTypes);
-	List_destroy(&procedure->returnedTypes);
-	List_destroy(&procedure->body);
-	free(procedure);
+	fprintf(stdout, "procedure %.*s\n", (signed int)tokens->lengths[procedure->name], Tokens_source(tokens, procedure->name));
+
+	fprintf(stdout, "required types:");
+
+	for (int64_t token = procedure->requiredTypes.begin; token < procedure->requiredTypes.end; ++token)
+	{
+		fprintf(stdout, " %.*s", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+	}
+
+	fprintf(stdout, "\n");
+
+	fprintf(stdout, "returned types:");
+
+	for (int64_t token = procedure->returnedTypes.begin; token < procedure->returnedTypes.end; ++token)
+	{
+		fprintf(stdout, " %.*s", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+	}
+
+	fprintf(stdout, "\n");
+
+	fprintf(stdout, "body:");
+
+	for (int64_t token = procedure->body.begin; token < procedure->body.end; ++token)
+	{
+		fprintf(stdout, " %.*s", (signed int)tokens->lengths[token], Tokens_source(tokens, token));
+	}
+
+	fprintf(stdout, "\n");
+
+	fprintf(stdout, "is main: %d\n", procedure->isMain != 0);
 }
 
-void Procedure_print(
-	const struct Procedure* const procedure)
+struct Globals Globals_create(
+	struct Arena* const arena)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The arena, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(arena != NULL);
+
+	struct Globals globals = {0};
+	globals.arena = arena;
+	globals.tokens = NULL;
+	globals.procedures = List_create(arena);
+	globals.stringLiterals = List_create(arena);
+	globals.procedureSlots = NULL;
+	globals.procedureSlotsCapacity = 0;
+	globals.main = NULL;
+	globals.stringSlots = NULL;
+	globals.stringSlotsCapacity = 0;
+	globals.stringIndices = NULL;
+	globals.stringIndicesCapacity = 0;
+	return globals;
+}
+
+#define GLOBALS_MINIMAL_CAPACITY ((int64_t)64)
+
+static uint64_t Globals_hash(
+	const int64_t symbolId);
+
+static void Globals_rehash(
+	struct Globals* const globals,
+	const int64_t slotsCapacity);
+
+static void Globals_rehashStrings(
+	struct Globals* const globals,
+	const int64_t slotsCapacity);
+
+struct Procedure* Globals_define(
+	struct Globals* const globals,
+	struct Procedure* const procedure)
 {
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The globals, provided to this function, must never ever be null, and must have
+	//        the tokens, since the names are keyed by their symbol ids.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(globals != NULL && globals->tokens != NULL);
+
 	// NOTE: using `assert` and not `if`
 	// REASONS:
 	//     1. The procedure, provided to this function, must never ever be null.
@@ -641,82 +1324,205 @@ void Procedure_print(
 	//        and debug configuration.
 	assert(procedure != NULL);
 
-	fprintf(stdout, "procedure %.*s\n", (signed int)procedure->name->source.length, procedure->name->source.buffer);
+	const int64_t symbolId = globals->tokens->symbolIds[procedure->name];
 
-	fprintf(stdout, "required types:");
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. Every procedure name is interned by the lexer.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(symbolId != INVALID_SYMBOL);
+
+	// Keeping the table at most half full, so the probe sequences stay short
+	if ((globals->procedures.count + 1) * 2 > globals->procedureSlotsCapacity)
+	{
+		Globals_rehash(globals, globals->procedureSlotsCapacity > 0 ? globals->procedureSlotsCapacity * 2 : GLOBALS_MINIMAL_CAPACITY);
+	}
 
-	if (procedure->requiredTypes.count > 0)
+	const uint64_t mask = (uint64_t)globals->procedureSlotsCapacity - 1;
+
+	for (uint64_t slot = Globals_hash(symbolId) & mask;; slot = (slot + 1) & mask)
 	{
-		for (struct LNode* iterator = procedure->requiredTypes.front; iterator != NULL; iterator = iterator->next)
+		struct Procedure* existing = globals->procedureSlots[slot];
+
+		if (existing == NULL)
 		{
-			// NOTE: using `assert` and not `if`
-			// REASONS:
-			//     1. The iterator's data, in the list must never be of value null.
-			//     2. This assert will prevent developers infliced bugs and development
-			//        and debug configuration.
-			assert(iterator->data != NULL);
+			procedure->index = globals->procedures.count;
+			globals->procedureSlots[slot] = procedure;
+			List_push(&globals->procedures, procedure);
+
+			if (procedure->isMain)
+			{
+				globals->main = procedure;
+			}
 
-			struct Token* token = (struct Token*)iterator->data;
-			fprintf(stdout, " %.*s", (signed int)token->source.length, token->source.buffer);
+			return NULL;
+		}
+
+		if (globals->tokens->symbolIds[existing->name] == symbolId)
+		{
+			return existing;
 		}
 	}
+}
 
-	fprintf(stdout, "\n");
+struct Procedure* Globals_find(
+	const struct Globals* const globals,
+	const int64_t symbolId)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The globals, provided to this function, must never ever be null, and must have
+	//        the tokens, since the names are keyed by their symbol ids.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(globals != NULL && globals->tokens != NULL);
 
-	fprintf(stdout, "returned types:");
+	if (symbolId == INVALID_SYMBOL || globals->procedureSlotsCapacity <= 0)
+	{
+		return NULL;
+	}
+
+	const uint64_t mask = (uint64_t)globals->procedureSlotsCapacity - 1;
 
-	if (procedure->returnedTypes.count > 0)
+	for (uint64_t slot = Globals_hash(symbolId) & mask;; slot = (slot + 1) & mask)
 	{
-		for (struct LNode* iterator = procedure->returnedTypes.front; iterator != NULL; iterator = iterator->next)
+		struct Procedure* existing = globals->procedureSlots[slot];
+
+		if (existing == NULL || globals->tokens->symbolIds[existing->name] == symbolId)
 		{
-			// NOTE: using `assert` and not `if`
-			// REASONS:
-			//     1. The iterator's data, in the list must never be of value null.
-			//     2. This assert will prevent developers infliced bugs and development
-			//        and debug configuration.
-			assert(iterator->data != NULL);
+			return existing;
+		}
+	}
+}
+
+int64_t Globals_poolString(
+	struct Globals* const globals,
+	const int64_t token)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The globals, provided to this function, must never ever be null, and must have
+	//        the tokens, the string literals are pooled from.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(globals != NULL && globals->tokens != NULL);
 
-			struct Token* token = (struct Token*)iterator->data;
-			fprintf(stdout, " %.*s", (signed int)token->source.length, token->source.buffer);
+	const struct Tokens* tokens = globals->tokens;
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. Only the string literal tokens, interned by the lexer, can be pooled.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(token >= 0 && token < tokens->count && tokens->kinds[token] == TOKEN_LITERAL_STRING
+		&& tokens->symbolIds[token] >= 0 && tokens->symbolIds[token] < tokens->symbols.count);
+
+	const int64_t symbolId = tokens->symbolIds[token];
+
+	// NOTE: the symbols keep being interned, while the tokens are pulled procedure by procedure,
+	//       so the indices grow along with them.
+	if (symbolId >= globals->stringIndicesCapacity)
+	{
+		const int64_t capacity = tokens->symbols.count > globals->stringIndicesCapacity * 2 ? tokens->symbols.count : globals->stringIndicesCapacity * 2;
+		int64_t* stringIndices = (int64_t*)Arena_allocate(globals->arena, capacity * (int64_t)sizeof(int64_t));
+
+		for (int64_t symbol = 0; symbol < capacity; ++symbol)
+		{
+			stringIndices[symbol] = symbol < globals->stringIndicesCapacity ? globals->stringIndices[symbol] : -1;
 		}
+
+		globals->stringIndices = stringIndices;
+		globals->stringIndicesCapacity = capacity;
 	}
 
-	fprintf(stdout, "\n");
+	// Equally spelled string literals are already pooled under their symbol id
+	if (globals->stringIndices[symbolId] >= 0)
+	{
+		return globals->stringIndices[symbolId];
+	}
 
-	fprintf(stdout, "body:");
+	// Keeping the table at most half full, so the probe sequences stay short
+	if ((globals->stringLiterals.count + 1) * 2 > globals->stringSlotsCapacity)
+	{
+		Globals_rehashStrings(globals, globals->stringSlotsCapacity > 0 ? globals->stringSlotsCapacity * 2 : GLOBALS_MINIMAL_CAPACITY);
+	}
+
+	const unsigned char* bytes = tokens->values[token].string.bytes;
+	const int64_t length = tokens->values[token].string.length;
+	const uint64_t hash = Symbols_hash((const char*)bytes, length);
+	const uint64_t mask = (uint64_t)globals->stringSlotsCapacity - 1;
 
-	if (procedure->body.count > 0)
+	for (uint64_t slot = hash & mask;; slot = (slot + 1) & mask)
 	{
-		for (struct LNode* iterator = procedure->body.front; iterator != NULL; iterator = iterator->next)
+		struct StringLiteral* existing = globals->stringSlots[slot];
+
+		if (existing == NULL)
 		{
-			// NOTE: using `assert` and not `if`
-			// REASONS:
-			//     1. The iterator's data, in the list must never be of value null.
-			//     2. This assert will prevent developers infliced bugs and development
-			//        and debug configuration.
-			assert(iterator->data != NULL);
+			unsigned char* copy = (unsigned char*)Arena_allocate(globals->arena, length > 0 ? length : 1);
+
+			if (length > 0)
+			{
+				memcpy(copy, bytes, (size_t)length);
+			}
+
+			struct StringLiteral* stringLiteral = (struct StringLiteral*)Arena_allocate(globals->arena, sizeof(struct StringLiteral));
+			stringLiteral->bytes = copy;
+			stringLiteral->length = length;
+			stringLiteral->index = globals->stringLiterals.count;
+			stringLiteral->hash = hash;
+			List_push(&globals->stringLiterals, stringLiteral);
+
+			globals->stringSlots[slot] = stringLiteral;
+			globals->stringIndices[symbolId] = stringLiteral->index;
+			return stringLiteral->index;
+		}
 
-			struct Token* token = (struct Token*)iterator->data;
-			fprintf(stdout, " %.*s", (signed int)token->source.length, token->source.buffer);
+		if (existing->hash == hash
+		 && existing->length == length
+		 && memcmp(existing->bytes, bytes, (size_t)length) == 0)
+		{
+			globals->stringIndices[symbolId] = existing->index;
+			return existing->index;
 		}
 	}
+}
 
-	fprintf(stdout, "\n");
+int64_t Globals_stringIndex(
+	const struct Globals* const globals,
+	const int64_t token)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The string literals must be pooled by the parser, before their indices are
+	//        requested.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(globals != NULL && globals->tokens != NULL && globals->stringIndices != NULL);
 
-	fprintf(stdout, "is main: %d\n", procedure->isMain != 0);
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. Only the pooled string literal tokens have the pool indices.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(token >= 0 && token < globals->tokens->count && globals->tokens->kinds[token] == TOKEN_LITERAL_STRING
+		&& globals->tokens->symbolIds[token] < globals->stringIndicesCapacity
+		&& globals->stringIndices[globals->tokens->symbolIds[token]] >= 0);
+
+	return globals->stringIndices[globals->tokens->symbolIds[token]];
 }
 
-struct Globals Globals_create(
-	void)
+static uint64_t Globals_hash(
+	const int64_t symbolId)
 {
-	struct Globals globals = {0};
-	globals.procedures = List_create();
-	globals.stringLiterals = List_create();
-	return globals;
+	// NOTE: symbol ids are dense, so they are only scattered with the Fibonacci hashing, to
+	//       keep neighbouring ids in different probe sequences.
+	return ((uint64_t)symbolId * (uint64_t)11400714819323198485ULL) >> 17;
 }
 
-void Globals_destroy(
-	struct Globals* const globals)
+static void Globals_rehash(
+	struct Globals* const globals,
+	const int64_t slotsCapacity)
 {
 	// NOTE: using `assert` and not `if`
 	// REASONS:
@@ -725,24 +1531,83 @@ void Globals_destroy(
 	//        and debug configuration.
 	assert(globals != NULL);
 
-	for (struct LNode* proceduresIterator = globals->procedures.front; proceduresIterator != NULL; proceduresIterator = proceduresIterator->next)
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The slots capacity must be a power of 2, the slots are picked with a mask.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(slotsCapacity > 0 && (slotsCapacity & (slotsCapacity - 1)) == 0);
+
+	struct Procedure** slots = (struct Procedure**)Arena_allocate(globals->arena, slotsCapacity * (int64_t)sizeof(struct Procedure*));
+	memset(slots, 0, (size_t)slotsCapacity * sizeof(struct Procedure*));
+	const uint64_t mask = (uint64_t)slotsCapacity - 1;
+
+	for (int64_t slot = 0; slot < globals->procedureSlotsCapacity; ++slot)
 	{
-		// NOTE: using `assert` and not `if`
-		// REASONS:
-		//     1. The data of the procedure iterator node, in the list must never be
-		//        of value null.
-		//     2. This assert will prevent developers infliced bugs and development
-		//        and debug configuration.
-		assert(proceduresIterator->data != NULL);
+		struct Procedure* procedure = globals->procedureSlots[slot];
+
+		if (procedure == NULL)
+		{
+			continue;
+		}
+
+		uint64_t target = Globals_hash(globals->tokens->symbolIds[procedure->name]) & mask;
 
-		struct Procedure* procedure = (struct Procedure*)proceduresIterator->data;
+		while (slots[target] != NULL)
+		{
+			target = (target + 1) & mask;
+		}
 
-		Procedure_destroy(procedure);
+		slots[target] = procedure;
 	}
 
-	List_destroy(&globals->procedures);
+	globals->procedureSlots = slots;
+	globals->procedureSlotsCapacity = slotsCapacity;
+}
+
+static void Globals_rehashStrings(
+	struct Globals* const globals,
+	const int64_t slotsCapacity)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The globals, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(globals != NULL);
+
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The slots capacity must be a power of 2, the slots are picked with a mask.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(slotsCapacity > 0 && (slotsCapacity & (slotsCapacity - 1)) == 0);
+
+	struct StringLiteral** slots = (struct StringLiteral**)Arena_allocate(globals->arena, slotsCapacity * (int64_t)sizeof(struct StringLiteral*));
+	memset(slots, 0, (size_t)slotsCapacity * sizeof(struct StringLiteral*));
+	const uint64_t mask = (uint64_t)slotsCapacity - 1;
+
+	for (int64_t slot = 0; slot < globals->stringSlotsCapacity; ++slot)
+	{
+		struct StringLiteral* stringLiteral = globals->stringSlots[slot];
+
+		if (stringLiteral == NULL)
+		{
+			continue;
+		}
+
+		uint64_t target = stringLiteral->hash & mask;
+
+		while (slots[target] != NULL)
+		{
+			target = (target + 1) & mask;
+		}
+
+		slots[target] = stringLiteral;
+	}
 
-	List_destroy(&globals->stringLiterals);
+	globals->stringSlots = slots;
+	globals->stringSlotsCapacity = slotsCapacity;
 }
 
 const char* Severity_stringify(
@@ -13,18 +13,210 @@
 #include <validator.h>
 
 #include <assert.h>
+#include <stdatomic.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
+#ifdef WIN32
+// TODO: add equivalent of pthread.h!
+#	error "TODO: need to add equivalent of pthread.h!"
+#else
+#	include <pthread.h>
+#endif
+
 /**
  * @addtogroup validator
  * 
  * @{
  */
 
+// NOTE: modules with fewer instructions than this per worker are validated on the calling
+//       thread, since spawning the workers would take longer than validating them.
+#define VALIDATOR_MINIMAL_INSTRUCTIONS_PER_WORKER ((int64_t)(64 * 1024))
+#define VALIDATOR_MAXIMAL_WORKERS_COUNT ((int64_t)64)
+
+enum { VALUE_TYPE_I64 = 0, VALUE_TYPE_P64 };
+
+// NOTE: the stack effect of an intrinsic. The types of the top `checkedCount` inputs (at most 2)
+//       form the combination `(a << 1) | b`, where `a` is the deeper one, and the `results`
+//       give the type of the result for every combination, or reject it. The outputs are
+//       pushed in order, each one either being the result, or a copy of one of the inputs,
+//       counting from the deepest one.
+#define VALIDATOR_REJECTED ((unsigned char)0xff)
+#define VALIDATOR_OUTPUT_RESULT ((unsigned char)0)
+#define VALIDATOR_OUTPUT_INPUT(index) ((unsigned char)(1 + (index)))
+#define VALIDATOR_MAXIMAL_OUTPUTS_COUNT 3
+
+struct ValidatorSignature
+{
+	const char* kind; // of the intrinsic, as named in the diagnostics
+	const char* supported; // sets of arguments, as named in the diagnostics
+	unsigned char inputsCount;
+	unsigned char checkedCount;
+	unsigned char results[4];
+	unsigned char outputsCount;
+	unsigned char outputs[VALIDATOR_MAXIMAL_OUTPUTS_COUNT];
+};
+
+// NOTE: indexed by the intrinsic opcodes, all of them must have their signature here.
+static const struct ValidatorSignature signatures[OPCODE_LAST_INTRINSIC - OPCODE_FIRST_INTRINSIC + 1] =
+{
+	[OPCODE_ADD - OPCODE_FIRST_INTRINSIC]      = { "intrinsic", "(i64 i64), (i64 p64), or (p64 i64) sets", 2, 2, { VALUE_TYPE_I64, VALUE_TYPE_P64, VALUE_TYPE_P64, VALIDATOR_REJECTED }, 1, { VALIDATOR_OUTPUT_RESULT } },
+	[OPCODE_SUBTRACT - OPCODE_FIRST_INTRINSIC] = { "intrinsic", "(i64 i64) or (p64 i64) sets", 2, 2, { VALUE_TYPE_I64, VALIDATOR_REJECTED, VALUE_TYPE_P64, VALIDATOR_REJECTED }, 1, { VALIDATOR_OUTPUT_RESULT } },
+	[OPCODE_MULTIPLY - OPCODE_FIRST_INTRINSIC] = { "intrinsic", "(i64 i64) set", 2, 2, { VALUE_TYPE_I64, VALIDATOR_REJECTED, VALIDATOR_REJECTED, VALIDATOR_REJECTED }, 1, { VALIDATOR_OUTPUT_RESULT } },
+	[OPCODE_DIVIDE - OPCODE_FIRST_INTRINSIC]   = { "intrinsic", "(i64 i64) set", 2, 2, { VALUE_TYPE_I64, VALIDATOR_REJECTED, VALIDATOR_REJECTED, VALIDATOR_REJECTED }, 1, { VALIDATOR_OUTPUT_RESULT } },
+	[OPCODE_MODULUS - OPCODE_FIRST_INTRINSIC]  = { "intrinsic", "(i64 i64) set", 2, 2, { VALUE_TYPE_I64, VALIDATOR_REJECTED, VALIDATOR_REJECTED, VALIDATOR_REJECTED }, 1, { VALIDATOR_OUTPUT_RESULT } },
+	[OPCODE_EQUAL - OPCODE_FIRST_INTRINSIC]    = { "intrinsic", "(i64 i64), (p64 p64), or (a64 a64) sets", 2, 2, { VALUE_TYPE_I64, VALIDATOR_REJECTED, VALIDATOR_REJECTED, VALUE_TYPE_P64 }, 1, { VALIDATOR_OUTPUT_RESULT } },
+	[OPCODE_NEQUAL - OPCODE_FIRST_INTRINSIC]   = { "intrinsic", "(i64 i64), (p64 p64), or (a64 a64) sets", 2, 2, { VALUE_TYPE_I64, VALIDATOR_REJECTED, VALIDATOR_REJECTED, VALUE_TYPE_P64 }, 1, { VALIDATOR_OUTPUT_RESULT } },
+	[OPCODE_GREATER - OPCODE_FIRST_INTRINSIC]  = { "intrinsic", "(i64 i64), (p64 p64), or (a64 a64) sets", 2, 2, { VALUE_TYPE_I64, VALIDATOR_REJECTED, VALIDATOR_REJECTED, VALUE_TYPE_P64 }, 1, { VALIDATOR_OUTPUT_RESULT } },
+	[OPCODE_LESS - OPCODE_FIRST_INTRINSIC]     = { "intrinsic", "(i64 i64), (p64 p64), or (a64 a64) sets", 2, 2, { VALUE_TYPE_I64, VALIDATOR_REJECTED, VALIDATOR_REJECTED, VALUE_TYPE_P64 }, 1, { VALIDATOR_OUTPUT_RESULT } },
+	[OPCODE_BAND - OPCODE_FIRST_INTRINSIC]     = { "intrinsic", "(i64 i64) set", 2, 2, { VALUE_TYPE_I64, VALIDATOR_REJECTED, VALIDATOR_REJECTED, VALIDATOR_REJECTED }, 1, { VALIDATOR_OUTPUT_RESULT } },
+	[OPCODE_BOR - OPCODE_FIRST_INTRINSIC]      = { "intrinsic", "(i64 i64) set", 2, 2, { VALUE_TYPE_I64, VALIDATOR_REJECTED, VALIDATOR_REJECTED, VALIDATOR_REJECTED }, 1, { VALIDATOR_OUTPUT_RESULT } },
+	[OPCODE_BNOT - OPCODE_FIRST_INTRINSIC]     = { "intrinsic", "(i64) set", 1, 1, { VALUE_TYPE_I64, VALIDATOR_REJECTED }, 1, { VALIDATOR_OUTPUT_RESULT } },
+	[OPCODE_SHIFTL - OPCODE_FIRST_INTRINSIC]   = { "intrinsic", "(i64 i64) set", 2, 2, { VALUE_TYPE_I64, VALIDATOR_REJECTED, VALIDATOR_REJECTED, VALIDATOR_REJECTED }, 1, { VALIDATOR_OUTPUT_RESULT } },
+	[OPCODE_SHIFTR - OPCODE_FIRST_INTRINSIC]   = { "intrinsic", "(i64 i64) set", 2, 2, { VALUE_TYPE_I64, VALIDATOR_REJECTED, VALIDATOR_REJECTED, VALIDATOR_REJECTED }, 1, { VALIDATOR_OUTPUT_RESULT } },
+	[OPCODE_SYSCALL0 - OPCODE_FIRST_INTRINSIC] = { "intrinsic", NULL, 1, 0, { VALUE_TYPE_I64 }, 1, { VALIDATOR_OUTPUT_RESULT } },
+	[OPCODE_SYSCALL1 - OPCODE_FIRST_INTRINSIC] = { "intrinsic", NULL, 2, 0, { VALUE_TYPE_I64 }, 1, { VALIDATOR_OUTPUT_RESULT } },
+	[OPCODE_SYSCALL2 - OPCODE_FIRST_INTRINSIC] = { "intrinsic", NULL, 3, 0, { VALUE_TYPE_I64 }, 1, { VALIDATOR_OUTPUT_RESULT } },
+	[OPCODE_SYSCALL3 - OPCODE_FIRST_INTRINSIC] = { "intrinsic", NULL, 4, 0, { VALUE_TYPE_I64 }, 1, { VALIDATOR_OUTPUT_RESULT } },
+	[OPCODE_SYSCALL4 - OPCODE_FIRST_INTRINSIC] = { "intrinsic", NULL, 5, 0, { VALUE_TYPE_I64 }, 1, { VALIDATOR_OUTPUT_RESULT } },
+	[OPCODE_SYSCALL5 - OPCODE_FIRST_INTRINSIC] = { "intrinsic", NULL, 6, 0, { VALUE_TYPE_I64 }, 1, { VALIDATOR_OUTPUT_RESULT } },
+	[OPCODE_SYSCALL6 - OPCODE_FIRST_INTRINSIC] = { "intrinsic", NULL, 7, 0, { VALUE_TYPE_I64 }, 1, { VALIDATOR_OUTPUT_RESULT } },
+	[OPCODE_CLONE - OPCODE_FIRST_INTRINSIC]    = { "intrinsic", NULL, 1, 0, { 0 }, 2, { VALIDATOR_OUTPUT_INPUT(0), VALIDATOR_OUTPUT_INPUT(0) } },
+	[OPCODE_DROP - OPCODE_FIRST_INTRINSIC]     = { "intrinsic", NULL, 1, 0, { 0 }, 0, { 0 } },
+	[OPCODE_OVER - OPCODE_FIRST_INTRINSIC]     = { "intrinsic", NULL, 2, 0, { 0 }, 3, { VALIDATOR_OUTPUT_INPUT(0), VALIDATOR_OUTPUT_INPUT(1), VALIDATOR_OUTPUT_INPUT(0) } },
+#if HIVEC_DEBUG
+// TODO: remove:
+	[OPCODE_PRINTN - OPCODE_FIRST_INTRINSIC]   = { "dev-intrinsic", NULL, 1, 0, { 0 }, 0, { 0 } },
+#endif
+	[OPCODE_SWAP - OPCODE_FIRST_INTRINSIC]     = { "intrinsic", NULL, 2, 0, { 0 }, 2, { VALIDATOR_OUTPUT_INPUT(1), VALIDATOR_OUTPUT_INPUT(0) } },
+};
+
+// NOTE: only the widths of the ranges are compared, so it is `Validator_checkSignatures`, that
+//       makes sure every intrinsic opcode has its signature.
+static_assert(OPCODE_LAST_INTRINSIC - OPCODE_FIRST_INTRINSIC == TOKEN_LAST_INTRINSIC - TOKEN_FIRST_INTRINSIC,
+	"the intrinsic opcodes range must be as wide as the intrinsic token kinds range!");
+
+// NOTE: the simulated data stack of the validated procedure, one type tag per value. It is
+//       reserved upfront for the deepest stack, that the procedure can reach (see
+//       `Validator_measureDepth`), so neither pushing, nor popping ever allocates.
+struct ValidatorStack
+{
+	unsigned char* types;
+	int64_t count;
+	int64_t capacity;
+};
+
+// NOTE: the stacks, that the branches of the control-flow bring to the instructions, where
+//       they join. The first branch, that reaches a join, records its stack there, and every
+//       other branch must bring the same stack. The bodies are lowered from structured blocks,
+//       so walking the instructions in order reaches every join after all its forward jumps,
+//       while the backward jumps (closing the loops) always return to an already recorded one.
+struct ValidatorJoin
+{
+	int64_t types; // offset of the recorded types in the joins' types, or -1
+	int64_t depth;
+	signed char isLoop; // targeted by a backward jump
+};
+
+struct ValidatorJoins
+{
+	struct ValidatorJoin* joins; // by the instructions
+	int64_t capacity;
+	unsigned char* types;
+	int64_t typesCount;
+	int64_t typesCapacity;
+};
+
+// NOTE: the procedures, shared by the validating workers. Every worker claims the next not
+//       yet validated procedure, so the workers, that got the cheap procedures, keep taking
+//       more, until none are left. The diagnostics of every procedure are kept in its own
+//       queue and are merged in the source order, once all workers are done.
+struct ValidatorPool
+{
+	const struct Globals* globals;
+	struct Procedure** procedures; // in the definition order
+	int64_t proceduresCount;
+	struct Queue* logs; // of every procedure
+	atomic_int_fast64_t next; // procedure to be claimed
+	atomic_int_fast64_t failed; // the first procedure, that failed, or the procedures count
+};
+
+struct ValidatorWorker
+{
+	struct ValidatorPool* pool;
+	struct ValidatorStack stack; // reused by the validated procedures
+	struct ValidatorJoins joins; // reused by the validated procedures
+};
+
+static void ValidatorStack_reserve(
+	struct ValidatorStack* const stack,
+	const int64_t capacity);
+
+static void ValidatorStack_destroy(
+	struct ValidatorStack* const stack);
+
+static inline void ValidatorStack_push(
+	struct ValidatorStack* const stack,
+	const unsigned char type);
+
+static inline unsigned char ValidatorStack_pop(
+	struct ValidatorStack* const stack);
+
+static inline unsigned char ValidatorStack_peek(
+	const struct ValidatorStack* const stack);
+
+static inline void ValidatorStack_drop(
+	struct ValidatorStack* const stack,
+	const int64_t count);
+
+static void ValidatorJoins_reset(
+	struct ValidatorJoins* const joins,
+	const struct Procedure* const procedure);
+
+static void ValidatorJoins_destroy(
+	struct ValidatorJoins* const joins);
+
+static void ValidatorJoins_record(
+	struct ValidatorJoins* const joins,
+	const int64_t instruction,
+	const struct ValidatorStack* const stack);
+
+static signed char Validator_join(
+	const struct Tokens* const tokens,
+	const struct Procedure* const procedure,
+	struct ValidatorJoins* const joins,
+	const int64_t instruction,
+	const struct ValidatorStack* const stack,
+	struct Queue* const logs);
+
+static int64_t Validator_measureDepth(
+	const struct Globals* const globals,
+	const struct Procedure* const procedure);
+
+static signed char Validator_validateProcedure(
+	const struct Globals* const globals,
+	struct Procedure* const procedure,
+	struct ValidatorStack* const stack,
+	struct ValidatorJoins* const joins,
+	struct Queue* const logs);
+
+#if HIVEC_DEBUG
+static void Validator_checkSignatures(
+	void);
+#endif
+
+static void* Validator_work(
+	void* const data);
+
+static int64_t Validator_countWorkers(
+	const struct Globals* const globals,
+	const int64_t threadsCount);
+
 signed char Validator_validateTokens(
 	struct Globals* const globals,
+	const int64_t threadsCount,
 	struct Queue* const logs)
 {
 	// NOTE: using `assert` and not `if`
@@ -34,6 +226,13 @@ signed char Validator_validateTokens(
 	//        and debug configuration.
 	assert(globals != NULL);
 
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The threads count is resolved by the caller, and must never be less than one.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(threadsCount > 0);
+
 	// NOTE: using `assert` and not `if`
 	// REASONS:
 	//     1. The logs, provided to this function, must never ever be null.
@@ -47,742 +246,674 @@ signed char Validator_validateTokens(
 	//     process.
 	assert(globals->procedures.count > 0);
 
-	enum { VALUE_TYPE_I64 = 0, VALUE_TYPE_P64 };
-	static int64_t I64_VALUE_TYPE = (int64_t)VALUE_TYPE_I64;
-	static int64_t P64_VALUE_TYPE = (int64_t)VALUE_TYPE_P64;
+#if HIVEC_DEBUG
+	// Making sure every intrinsic opcode has its signature
+	Validator_checkSignatures();
+#endif
 
-	for (struct LNode* proceduresIterator = globals->procedures.front; proceduresIterator != NULL; proceduresIterator = proceduresIterator->next)
-	{
-		// NOTE: using `assert` and not `if`
-		// REASONS:
-		//     1. The procedures iterator's data, in the list must never be of value
-		//        null.
-		//     2. This assert will prevent developers infliced bugs and development
-		//        and debug configuration.
-		assert(proceduresIterator->data != NULL);
+	const int64_t workersCount = Validator_countWorkers(globals, threadsCount);
 
-		struct Procedure* procedure = (struct Procedure*)proceduresIterator->data;
-		struct Stack stack = Stack_create();
+	if (workersCount <= 1)
+	{
+		struct ValidatorStack stack = {0};
+		struct ValidatorJoins joins = {0};
+		signed char valid = 1;
 
-		for (struct LNode* requiredTypesIterator = procedure->requiredTypes.front; requiredTypesIterator != NULL; requiredTypesIterator = requiredTypesIterator->next)
+		for (int64_t index = 0; valid && index < globals->procedures.count; ++index)
 		{
-			// NOTE: using `assert` and not `if`
-			// REASONS:
-			//     1. The required types iterator's data, in the list must never be of
-			//        value null.
-			//     2. This assert will prevent developers infliced bugs and development
-			//        and debug configuration.
-			assert(requiredTypesIterator->data != NULL);
-
-			struct Token* token = (struct Token*)requiredTypesIterator->data;
-
-			// NOTE: using `assert` and not `if`
-			// REASONS:
-			//     1. All required types tokens must be of correct type. I am leaving the
-			//        asserts for developers-inflicted erors and bugs in parser.
-			//     2. This assert will prevent developers infliced bugs and development
-			//        and debug configuration.
-			assert(token->kind == TOKEN_KEYWORD_I64 || token->kind == TOKEN_KEYWORD_P64);
-
-			if (token->kind == TOKEN_KEYWORD_I64)
-			{
-				Stack_push(&stack, &I64_VALUE_TYPE);
-			}
-			else if (token->kind == TOKEN_KEYWORD_P64)
-			{
-				Stack_push(&stack, &P64_VALUE_TYPE);
-			}
+			valid = Validator_validateProcedure(globals, (struct Procedure*)List_at(&globals->procedures, index), &stack, &joins, logs);
 		}
 
-		for (struct LNode* bodyIterator = procedure->body.front; bodyIterator != NULL; bodyIterator = bodyIterator->next)
-		{
-			// NOTE: using `assert` and not `if`
-			// REASONS:
-			//     1. The procedures iterator's data, in the list must never be of value
-			//        null.
-			//     2. This assert will prevent developers infliced bugs and development
-			//        and debug configuration.
-			assert(bodyIterator->data != NULL);
+		ValidatorStack_destroy(&stack);
+		ValidatorJoins_destroy(&joins);
+		return valid;
+	}
 
-			struct Token* token = (struct Token*)bodyIterator->data;
+	// STEPS:
+	//     1. Set up the pool of the procedures, and build the lines index of the source, since
+	//        the workers locate their diagnostics concurrently.
+	//     2. Validate the procedures on the workers and the calling thread.
+	//     3. Merge the diagnostics of the procedures up to the first failed one in the source
+	//        order, so the logs are the same, as if the procedures were validated one by one.
+
+	// [STEP 1] (Set up the pool of the procedures).
+	struct ValidatorPool pool = {0};
+	pool.globals = globals;
+	pool.proceduresCount = globals->procedures.count;
+	pool.procedures = (struct Procedure**)globals->procedures.elements;
+	pool.logs = (struct Queue*)Arena_allocate(globals->arena, pool.proceduresCount * (int64_t)sizeof(struct Queue));
+	atomic_init(&pool.next, 0);
+	atomic_init(&pool.failed, pool.proceduresCount);
+
+	for (int64_t index = 0; index < pool.proceduresCount; ++index)
+	{
+		pool.logs[index] = Queue_create(NULL);
+	}
 
-			switch (token->kind)
-			{
-				case TOKEN_KEYWORD_DO:
-				{
-					if (token->previousRef != NULL && token->previousRef->kind == TOKEN_KEYWORD_PROCEDURE)
-					{
-						break;
-					}
+	Source_indexLines(globals->tokens->source);
 
-					if (stack.count <= 0)
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` keyword requires 1 argument to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
+	// [STEP 2] (Validate the procedures on the workers and the calling thread).
+	struct ValidatorWorker workers[VALIDATOR_MAXIMAL_WORKERS_COUNT];
+	pthread_t threads[VALIDATOR_MAXIMAL_WORKERS_COUNT];
+	signed char spawned[VALIDATOR_MAXIMAL_WORKERS_COUNT] = {0};
 
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
+	for (int64_t index = 0; index < workersCount; ++index)
+	{
+		workers[index].pool = &pool;
+		workers[index].stack = (struct ValidatorStack) {0};
+		workers[index].joins = (struct ValidatorJoins) {0};
+	}
 
-						return 0;
-					}
+	// NOTE: in case a worker cannot be spawned, the others (and the calling thread) simply
+	//       claim its share of the procedures.
+	for (int64_t index = 1; index < workersCount; ++index)
+	{
+		spawned[index] = pthread_create(&threads[index], NULL, Validator_work, &workers[index]) == 0;
+	}
 
-					int64_t a = *(int64_t*)Stack_pop(&stack);
+	Validator_work(&workers[0]);
 
-					if (a != I64_VALUE_TYPE)
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` keyword only supports (i64) sets of arguments!",
-							(signed int)token->source.length, token->source.buffer));
+	for (int64_t index = 1; index < workersCount; ++index)
+	{
+		if (spawned[index])
+		{
+			pthread_join(threads[index], NULL);
+		}
+	}
 
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
+	for (int64_t index = 0; index < workersCount; ++index)
+	{
+		ValidatorStack_destroy(&workers[index].stack);
+		ValidatorJoins_destroy(&workers[index].joins);
+	}
 
-						return 0;
-					}
-				} break;
+	// [STEP 3] (Merge the diagnostics of the procedures in the source order).
+	const int64_t failed = (int64_t)atomic_load(&pool.failed);
 
-				case TOKEN_INTRINSIC_ADD:
-				{
-					if (stack.count <= 1)
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 2 arguments to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
+	for (int64_t index = 0; index < pool.proceduresCount; ++index)
+	{
+		for (void* log = NULL; (log = Queue_dequeue(&pool.logs[index])) != NULL;)
+		{
+			if (index <= failed)
+			{
+				Queue_enqueue(logs, log);
+			}
+			else
+			{
+				Log_destroy((struct Log*)log);
+			}
+		}
 
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
+		Queue_destroy(&pool.logs[index]);
+	}
 
-						return 0;
-					}
+	return failed >= pool.proceduresCount;
+}
 
-					int64_t b = *(int64_t*)Stack_pop(&stack);
-					int64_t a = *(int64_t*)Stack_pop(&stack);
+signed char Validator_validateProcedureTokens(
+	const struct Globals* const globals,
+	struct Procedure* const procedure,
+	struct Queue* const logs)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The globals, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(globals != NULL);
 
-					if (a == I64_VALUE_TYPE && a == b)
-					{
-						Stack_push(&stack, &I64_VALUE_TYPE);
-					}
-					else if ((a == I64_VALUE_TYPE && b == P64_VALUE_TYPE) || (a == P64_VALUE_TYPE && b == I64_VALUE_TYPE))
-					{
-						Stack_push(&stack, &P64_VALUE_TYPE);
-					}
-					else
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic only supports (i64 i64), (i64 p64), or (p64 i64) sets of arguments!",
-							(signed int)token->source.length, token->source.buffer));
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The logs, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(logs != NULL);
 
 #if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
+	// Making sure every intrinsic opcode has its signature
+	Validator_checkSignatures();
 #endif
 
-						return 0;
-					}
-				} break;
+	struct ValidatorStack stack = {0};
+	struct ValidatorJoins joins = {0};
+	const signed char valid = Validator_validateProcedure(globals, procedure, &stack, &joins, logs);
+	ValidatorStack_destroy(&stack);
+	ValidatorJoins_destroy(&joins);
+	return valid;
+}
 
-				case TOKEN_INTRINSIC_SUBTRACT:
-				{
-					if (stack.count <= 1)
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 2 arguments to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
+static void ValidatorStack_reserve(
+	struct ValidatorStack* const stack,
+	const int64_t capacity)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The stack, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(stack != NULL);
 
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
+	if (capacity <= stack->capacity)
+	{
+		return;
+	}
 
-						return 0;
-					}
+	// NOTE: growing at least geometrically, so the procedures of increasing depths do not
+	//       reallocate the stack every time.
+	const int64_t grown = capacity > stack->capacity * 2 ? capacity : stack->capacity * 2;
+	stack->types = (unsigned char*)realloc(stack->types, (size_t)grown);
 
-					int64_t b = *(int64_t*)Stack_pop(&stack);
-					int64_t a = *(int64_t*)Stack_pop(&stack);
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The memory allocation errors can happen anytime, no matter build
+	//        configuration being debug or release. However, since the compiler
+	//        cannot prevent such bugs, I will leave it as assert. Worst case
+	//        scenario - the compiler crashes, and user re-runs it.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(stack->types != NULL);
 
-					if (a == I64_VALUE_TYPE && a == b)
-					{
-						Stack_push(&stack, &I64_VALUE_TYPE);
-					}
-					else if (a == P64_VALUE_TYPE && b == I64_VALUE_TYPE)
-					{
-						Stack_push(&stack, &P64_VALUE_TYPE);
-					}
-					else
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic only supports (i64 i64) or (p64 i64) sets of arguments!",
-							(signed int)token->source.length, token->source.buffer));
+	stack->capacity = grown;
+}
 
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
+static void ValidatorStack_destroy(
+	struct ValidatorStack* const stack)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The stack, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(stack != NULL);
 
-						return 0;
-					}
-				} break;
+	free(stack->types);
+	stack->types = NULL;
+	stack->count = 0;
+	stack->capacity = 0;
+}
 
-				case TOKEN_INTRINSIC_MULTIPLY:
-				{
-					if (stack.count <= 1)
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 2 arguments to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
+static inline void ValidatorStack_push(
+	struct ValidatorStack* const stack,
+	const unsigned char type)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The stack is reserved for the deepest stack of the procedure upfront, so it
+	//        must never overflow.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(stack->count < stack->capacity);
 
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
+	stack->types[stack->count++] = type;
+}
 
-						return 0;
-					}
+static inline unsigned char ValidatorStack_pop(
+	struct ValidatorStack* const stack)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The arguments count is checked before popping them, with a diagnostic.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(stack->count > 0);
 
-					int64_t b = *(int64_t*)Stack_pop(&stack);
-					int64_t a = *(int64_t*)Stack_pop(&stack);
+	return stack->types[--stack->count];
+}
 
-					if (a == I64_VALUE_TYPE && a == b)
-					{
-						Stack_push(&stack, &I64_VALUE_TYPE);
-					}
-					else
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic only supports (i64 i64) set of arguments!",
-							(signed int)token->source.length, token->source.buffer));
+static inline unsigned char ValidatorStack_peek(
+	const struct ValidatorStack* const stack)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The arguments count is checked before peeking them, with a diagnostic.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(stack->count > 0);
 
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
+	return stack->types[stack->count - 1];
+}
 
-						return 0;
-					}
-				} break;
+static inline void ValidatorStack_drop(
+	struct ValidatorStack* const stack,
+	const int64_t count)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The arguments count is checked before dropping them, with a diagnostic.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(count >= 0 && count <= stack->count);
 
-				case TOKEN_INTRINSIC_DIVIDE:
-				{
-					if (stack.count <= 1)
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 2 arguments to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
+	stack->count -= count;
+}
 
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
+static void ValidatorJoins_reset(
+	struct ValidatorJoins* const joins,
+	const struct Procedure* const procedure)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The joins and the procedure, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(joins != NULL && procedure != NULL);
 
-						return 0;
-					}
+	if (procedure->instructionsCount > joins->capacity)
+	{
+		const int64_t capacity = procedure->instructionsCount > joins->capacity * 2 ? procedure->instructionsCount : joins->capacity * 2;
+		joins->joins = (struct ValidatorJoin*)realloc(joins->joins, (size_t)capacity * sizeof(struct ValidatorJoin));
 
-					int64_t b = *(int64_t*)Stack_pop(&stack);
-					int64_t a = *(int64_t*)Stack_pop(&stack);
+		// NOTE: using `assert` and not `if`
+		// REASONS:
+		//     1. The memory allocation errors can happen anytime, no matter build
+		//        configuration being debug or release. However, since the compiler
+		//        cannot prevent such bugs, I will leave it as assert. Worst case
+		//        scenario - the compiler crashes, and user re-runs it.
+		//     2. This assert will prevent developers infliced bugs and development
+		//        and debug configuration.
+		assert(joins->joins != NULL);
 
-					if (a == I64_VALUE_TYPE && a == b)
-					{
-						Stack_push(&stack, &I64_VALUE_TYPE);
-					}
-					else
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic only supports (i64 i64) set of arguments!",
-							(signed int)token->source.length, token->source.buffer));
+		joins->capacity = capacity;
+	}
 
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
+	for (int64_t index = 0; index < procedure->instructionsCount; ++index)
+	{
+		joins->joins[index] = (struct ValidatorJoin) { .types = -1, .depth = 0, .isLoop = 0 };
+	}
 
-						return 0;
-					}
-				} break;
+	// NOTE: the loops are entered, before their backward jumps are walked, so their stacks
+	//       must be recorded on the way in.
+	for (int64_t index = 0; index < procedure->instructionsCount; ++index)
+	{
+		const struct Instruction* instruction = &procedure->instructions[index];
 
-				case TOKEN_INTRINSIC_MODULUS:
-				{
-					if (stack.count <= 1)
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 2 arguments to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
+		if ((instruction->opcode == OPCODE_JUMP || instruction->opcode == OPCODE_JUMP_UNLESS) && (int64_t)instruction->target <= index)
+		{
+			joins->joins[instruction->target].isLoop = 1;
+		}
+	}
 
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
+	joins->typesCount = 0;
+}
 
-						return 0;
-					}
+static void ValidatorJoins_destroy(
+	struct ValidatorJoins* const joins)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The joins, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(joins != NULL);
 
-					int64_t b = *(int64_t*)Stack_pop(&stack);
-					int64_t a = *(int64_t*)Stack_pop(&stack);
+	free(joins->joins);
+	free(joins->types);
+	*joins = (struct ValidatorJoins) {0};
+}
 
-					if (a == I64_VALUE_TYPE && a == b)
-					{
-						Stack_push(&stack, &I64_VALUE_TYPE);
-					}
-					else
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic only supports (i64 i64) set of arguments!",
-							(signed int)token->source.length, token->source.buffer));
-
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
-
-						return 0;
-					}
-				} break;
-
-				case TOKEN_INTRINSIC_EQUAL:
-				{
-					if (stack.count <= 1)
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 2 arguments to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
-
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
-
-						return 0;
-					}
-
-					int64_t b = *(int64_t*)Stack_pop(&stack);
-					int64_t a = *(int64_t*)Stack_pop(&stack);
-
-					if (a == b)
-					{
-						Stack_push(&stack, &a);
-					}
-					else
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic only supports (i64 i64), (p64 p64), or (a64 a64) sets of arguments!",
-							(signed int)token->source.length, token->source.buffer));
-
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
-
-						return 0;
-					}
-				} break;
-
-				case TOKEN_INTRINSIC_NEQUAL:
-				{
-					if (stack.count <= 1)
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 2 arguments to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
-
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
-
-						return 0;
-					}
-
-					int64_t b = *(int64_t*)Stack_pop(&stack);
-					int64_t a = *(int64_t*)Stack_pop(&stack);
-
-					if (a == b)
-					{
-						Stack_push(&stack, &a);
-					}
-					else
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic only supports (i64 i64), (p64 p64), or (a64 a64) sets of arguments!",
-							(signed int)token->source.length, token->source.buffer));
-
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
-
-						return 0;
-					}
-				} break;
-
-				case TOKEN_INTRINSIC_GREATER:
-				{
-					if (stack.count <= 1)
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 2 arguments to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
-
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
-
-						return 0;
-					}
-
-					int64_t b = *(int64_t*)Stack_pop(&stack);
-					int64_t a = *(int64_t*)Stack_pop(&stack);
+static void ValidatorJoins_record(
+	struct ValidatorJoins* const joins,
+	const int64_t instruction,
+	const struct ValidatorStack* const stack)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The joins and the stack, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(joins != NULL && stack != NULL);
 
-					if (a == b)
-					{
-						Stack_push(&stack, &a);
-					}
-					else
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic only supports (i64 i64), (p64 p64), or (a64 a64) sets of arguments!",
-							(signed int)token->source.length, token->source.buffer));
+	if (joins->typesCount + stack->count > joins->typesCapacity)
+	{
+		const int64_t required = joins->typesCount + stack->count;
+		const int64_t capacity = required > joins->typesCapacity * 2 ? required : joins->typesCapacity * 2;
+		joins->types = (unsigned char*)realloc(joins->types, (size_t)capacity);
 
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
+		// NOTE: using `assert` and not `if`
+		// REASONS:
+		//     1. The memory allocation errors can happen anytime, no matter build
+		//        configuration being debug or release. However, since the compiler
+		//        cannot prevent such bugs, I will leave it as assert. Worst case
+		//        scenario - the compiler crashes, and user re-runs it.
+		//     2. This assert will prevent developers infliced bugs and development
+		//        and debug configuration.
+		assert(joins->types != NULL);
 
-						return 0;
-					}
-				} break;
+		joins->typesCapacity = capacity;
+	}
 
-				case TOKEN_INTRINSIC_LESS:
-				{
-					if (stack.count <= 1)
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 2 arguments to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
+	struct ValidatorJoin* join = &joins->joins[instruction];
+	join->types = joins->typesCount;
+	join->depth = stack->count;
 
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
+	if (stack->count > 0)
+	{
+		memcpy(joins->types + joins->typesCount, stack->types, (size_t)stack->count);
+	}
 
-						return 0;
-					}
+	joins->typesCount += stack->count;
+}
 
-					int64_t b = *(int64_t*)Stack_pop(&stack);
-					int64_t a = *(int64_t*)Stack_pop(&stack);
+static signed char Validator_join(
+	const struct Tokens* const tokens,
+	const struct Procedure* const procedure,
+	struct ValidatorJoins* const joins,
+	const int64_t instruction,
+	const struct ValidatorStack* const stack,
+	struct Queue* const logs)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The tokens, the procedure, the joins, the stack and the logs, provided to this
+	//        function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(tokens != NULL && procedure != NULL && joins != NULL && stack != NULL && logs != NULL);
 
-					if (a == b)
-					{
-						Stack_push(&stack, &a);
-					}
-					else
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic only supports (i64 i64), (p64 p64), or (a64 a64) sets of arguments!",
-							(signed int)token->source.length, token->source.buffer));
+	const struct ValidatorJoin* join = &joins->joins[instruction];
 
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
+	if (join->types < 0)
+	{
+		ValidatorJoins_record(joins, instruction, stack);
+		return 1;
+	}
 
-						return 0;
-					}
-				} break;
+	// NOTE: the diagnostics name the instruction, where the branches join.
+	const int64_t token = (int64_t)procedure->instructions[instruction].token;
 
-				case TOKEN_INTRINSIC_BAND:
-				{
-					if (stack.count <= 1)
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 2 arguments to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
+	if (join->depth != stack->count)
+	{
+		Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, Tokens_location(tokens, token), "branches, joining at `%.*s`, leave different counts of values on the stack (%ld and %ld)!",
+			(signed int)tokens->lengths[token], Tokens_source(tokens, token), join->depth, stack->count));
 
 #if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
+		Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+			(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+			"locator of the log above this meesage."));
 #endif
 
-						return 0;
-					}
-
-					int64_t b = *(int64_t*)Stack_pop(&stack);
-					int64_t a = *(int64_t*)Stack_pop(&stack);
+		return 0;
+	}
 
-					if (a == I64_VALUE_TYPE && a == b)
-					{
-						Stack_push(&stack, &I64_VALUE_TYPE);
-					}
-					else
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic only supports (i64 i64) set of arguments!",
-							(signed int)token->source.length, token->source.buffer));
+	if (stack->count > 0 && memcmp(joins->types + join->types, stack->types, (size_t)stack->count) != 0)
+	{
+		Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, Tokens_location(tokens, token), "branches, joining at `%.*s`, leave different types on the stack!",
+			(signed int)tokens->lengths[token], Tokens_source(tokens, token)));
 
 #if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
+		Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+			(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+			"locator of the log above this meesage."));
 #endif
 
-						return 0;
-					}
-				} break;
-
-				case TOKEN_INTRINSIC_BOR:
-				{
-					if (stack.count <= 1)
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 2 arguments to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
+		return 0;
+	}
 
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
+	return 1;
+}
 
-						return 0;
-					}
+static int64_t Validator_measureDepth(
+	const struct Globals* const globals,
+	const struct Procedure* const procedure)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The globals and the procedure, provided to this function, must never ever be
+	//        null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(globals != NULL && procedure != NULL);
 
-					int64_t b = *(int64_t*)Stack_pop(&stack);
-					int64_t a = *(int64_t*)Stack_pop(&stack);
+	// NOTE: the stack can not get deeper, than the required values plus every value, that
+	//       any instruction can push more, than it pops.
+	int64_t depth = procedure->requiredTypes.end - procedure->requiredTypes.begin;
 
-					if (a == I64_VALUE_TYPE && a == b)
-					{
-						Stack_push(&stack, &I64_VALUE_TYPE);
-					}
-					else
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic only supports (i64 i64) set of arguments!",
-							(signed int)token->source.length, token->source.buffer));
+	for (int64_t index = 0; index < procedure->instructionsCount; ++index)
+	{
+		const struct Instruction* instruction = &procedure->instructions[index];
 
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
+		switch (instruction->opcode)
+		{
+			case OPCODE_PUSH_I64:
+			{
+				depth += 1;
+			} break;
 
-						return 0;
-					}
-				} break;
+			case OPCODE_PUSH_STRING:
+			{
+				depth += 2;
+			} break;
 
-				case TOKEN_INTRINSIC_BNOT:
+			case OPCODE_CALL:
+			{
+				if (instruction->operand != INVALID_PROCEDURE)
 				{
-					if (stack.count <= 0)
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 1 argument to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
-
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
-
-						return 0;
-					}
-
-					int64_t a = *(int64_t*)Stack_pop(&stack);
-
-					if (a == I64_VALUE_TYPE)
-					{
-						Stack_push(&stack, &I64_VALUE_TYPE);
-					}
-					else
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic only supports (i64) set of arguments!",
-							(signed int)token->source.length, token->source.buffer));
-
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
+					const struct Procedure* calledProcedure = (const struct Procedure*)List_at(&globals->procedures, instruction->operand);
+					depth += calledProcedure->returnedTypes.end - calledProcedure->returnedTypes.begin;
+				}
+			} break;
+
+			case OPCODE_JUMP:
+			case OPCODE_JUMP_UNLESS:
+			case OPCODE_RETURN:
+			{
+			} break;
 
-						return 0;
-					}
-				} break;
+			default:
+			{
+				const struct ValidatorSignature* signature = &signatures[instruction->opcode - OPCODE_FIRST_INTRINSIC];
 
-				case TOKEN_INTRINSIC_SHIFTL:
+				if (signature->outputsCount > signature->inputsCount)
 				{
-					if (stack.count <= 1)
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 2 arguments to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
+					depth += signature->outputsCount - signature->inputsCount;
+				}
+			} break;
+		}
+	}
 
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
+	return depth;
+}
 
-						return 0;
-					}
+static signed char Validator_validateProcedure(
+	const struct Globals* const globals,
+	struct Procedure* const procedure,
+	struct ValidatorStack* const stack,
+	struct ValidatorJoins* const joins,
+	struct Queue* const logs)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The globals, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(globals != NULL);
 
-					int64_t b = *(int64_t*)Stack_pop(&stack);
-					int64_t a = *(int64_t*)Stack_pop(&stack);
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The procedure, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(procedure != NULL);
 
-					if (a == I64_VALUE_TYPE && a == b)
-					{
-						Stack_push(&stack, &I64_VALUE_TYPE);
-					}
-					else
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic only supports (i64 i64) set of arguments!",
-							(signed int)token->source.length, token->source.buffer));
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The stack, provided to this function, must never ever be null. It must only be
+	//        used by the calling thread.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(stack != NULL);
 
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The joins, provided to this function, must never ever be null. They must only be
+	//        used by the calling thread.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(joins != NULL);
 
-						return 0;
-					}
-				} break;
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The logs, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(logs != NULL);
 
-				case TOKEN_INTRINSIC_SHIFTR:
-				{
-					if (stack.count <= 1)
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 2 arguments to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
+	const struct Tokens* tokens = globals->tokens;
 
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
+	ValidatorStack_reserve(stack, Validator_measureDepth(globals, procedure));
+	ValidatorJoins_reset(joins, procedure);
+	stack->count = 0;
 
-						return 0;
-					}
+	for (int64_t token = procedure->requiredTypes.begin; token < procedure->requiredTypes.end; ++token)
+	{
+		// NOTE: using `assert` and not `if`
+		// REASONS:
+		//     1. All required types tokens must be of correct type. I am leaving the
+		//        asserts for developers-inflicted erors and bugs in parser.
+		//     2. This assert will prevent developers infliced bugs and development
+		//        and debug configuration.
+		assert(tokens->kinds[token] == TOKEN_KEYWORD_I64 || tokens->kinds[token] == TOKEN_KEYWORD_P64);
 
-					int64_t b = *(int64_t*)Stack_pop(&stack);
-					int64_t a = *(int64_t*)Stack_pop(&stack);
+		if (tokens->kinds[token] == TOKEN_KEYWORD_I64)
+		{
+			ValidatorStack_push(stack, VALUE_TYPE_I64);
+		}
+		else if (tokens->kinds[token] == TOKEN_KEYWORD_P64)
+		{
+			ValidatorStack_push(stack, VALUE_TYPE_P64);
+		}
+	}
 
-					if (a == I64_VALUE_TYPE && a == b)
-					{
-						Stack_push(&stack, &I64_VALUE_TYPE);
-					}
-					else
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic only supports (i64 i64) set of arguments!",
-							(signed int)token->source.length, token->source.buffer));
+	// NOTE: the instructions are walked in order, carrying the stack along the fall-through
+	//       branch. The stack is joined with the recorded one at every jump's target, and once
+	//       the fall-through branch ends with a jump, the walk resumes with the stack, that the
+	//       jumps recorded at the next instruction.
+	signed char reachable = 1;
+	procedure->stackDepth = stack->count;
 
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
+	for (int64_t index = 0; index < procedure->instructionsCount; ++index)
+	{
+		struct Instruction* instruction = &procedure->instructions[index];
+		const int64_t token = (int64_t)instruction->token;
+		const struct ValidatorJoin* join = &joins->joins[index];
 
-						return 0;
-					}
-				} break;
+		if (join->types >= 0 && !reachable)
+		{
+			memcpy(stack->types, joins->types + join->types, (size_t)join->depth);
+			stack->count = join->depth;
+			reachable = 1;
+		}
+		else if (join->types >= 0)
+		{
+			if (!Validator_join(tokens, procedure, joins, index, stack, logs))
+			{
+				return 0;
+			}
+		}
+		else if (!reachable)
+		{
+			// NOTE: neither fall-through, nor any jump reach the instruction.
+			continue;
+		}
+		else if (join->isLoop)
+		{
+			ValidatorJoins_record(joins, index, stack);
+		}
 
-				case TOKEN_INTRINSIC_SYSCALL0:
+		instruction->depth = (uint32_t)stack->count;
+
+		// NOTE: the diagnostics name the tokens, that the instructions were lowered from.
+		switch (instruction->opcode)
+		{
+			case OPCODE_JUMP_UNLESS:
+			{
+				if (stack->count <= 0)
 				{
-					if (stack.count <= 0)
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 1 argument to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
+					Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, Tokens_location(tokens, token), "`%.*s` keyword requires 1 argument to be on the stack!",
+						(signed int)tokens->lengths[token], Tokens_source(tokens, token)));
 
 #if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
+					Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+						(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+						"locator of the log above this meesage."));
 #endif
 
-						return 0;
-					}
+					return 0;
+				}
 
-					Stack_pop(&stack);
-					Stack_push(&stack, &I64_VALUE_TYPE);
-				} break;
+				const unsigned char a = ValidatorStack_pop(stack);
 
-				case TOKEN_INTRINSIC_SYSCALL1:
+				if (a != VALUE_TYPE_I64)
 				{
-					if (stack.count <= 1)
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 2 arguments to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
+					Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, Tokens_location(tokens, token), "`%.*s` keyword only supports (i64) sets of arguments!",
+						(signed int)tokens->lengths[token], Tokens_source(tokens, token)));
 
 #if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
+					Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+						(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+						"locator of the log above this meesage."));
 #endif
 
-						return 0;
-					}
-
-					for (signed int i = 0; i < 2; ++i)
-					{
-						Stack_pop(&stack);
-					}
+					return 0;
+				}
 
-					Stack_push(&stack, &I64_VALUE_TYPE);
-				} break;
-
-				case TOKEN_INTRINSIC_SYSCALL2:
+				if (!Validator_join(tokens, procedure, joins, (int64_t)instruction->target, stack, logs))
 				{
-					if (stack.count <= 2)
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 3 arguments to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
+					return 0;
+				}
+			} break;
 
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
+			case OPCODE_JUMP:
+			{
+				if (!Validator_join(tokens, procedure, joins, (int64_t)instruction->target, stack, logs))
+				{
+					return 0;
+				}
 
-						return 0;
-					}
+				reachable = 0;
+			} break;
 
-					for (signed int i = 0; i < 3; ++i)
-					{
-						Stack_pop(&stack);
-					}
+			case OPCODE_PUSH_I64:
+			{
+				ValidatorStack_push(stack, VALUE_TYPE_I64);
+			} break;
 
-					Stack_push(&stack, &I64_VALUE_TYPE);
-				} break;
+			case OPCODE_PUSH_STRING:
+			{
+				ValidatorStack_push(stack, VALUE_TYPE_I64);
+				ValidatorStack_push(stack, VALUE_TYPE_P64);
+			} break;
 
-				case TOKEN_INTRINSIC_SYSCALL3:
+			case OPCODE_CALL:
+			{
+				// NOTE: the calls are resolved by the parser, the undefined procedures are left
+				//       invalid, to be reported here.
+				if (instruction->operand == INVALID_PROCEDURE)
 				{
-					if (stack.count <= 3)
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 4 arguments to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
+					Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, Tokens_location(tokens, token), "encountered undefined procedure `%.*s`!", (signed int)tokens->lengths[token], Tokens_source(tokens, token)));
 
 #if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
+					Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+						(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+						"locator of the log above this meesage."));
 #endif
 
-						return 0;
-					}
+					return 0;
+				}
 
-					for (signed int i = 0; i < 4; ++i)
-					{
-						Stack_pop(&stack);
-					}
+				const struct Procedure* calledProcedure = (const struct Procedure*)List_at(&globals->procedures, instruction->operand);
 
-					Stack_push(&stack, &I64_VALUE_TYPE);
-				} break;
+				// NOTE: the arguments are checked in place, from the top of the stack down, and are
+				//       dropped all at once.
+				const int64_t argumentsCount = calledProcedure->requiredTypes.end - calledProcedure->requiredTypes.begin;
 
-				case TOKEN_INTRINSIC_SYSCALL4:
+				for (int64_t temp = calledProcedure->requiredTypes.begin; temp < calledProcedure->requiredTypes.end; ++temp)
 				{
-					if (stack.count <= 4)
+					const int64_t depth = temp - calledProcedure->requiredTypes.begin;
+
+					if (depth >= stack->count)
 					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 5 arguments to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
+						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, Tokens_location(tokens, temp), "expected a `%.*s` type to be on the stack, but the stack was empty!", (signed int)tokens->lengths[temp], Tokens_source(tokens, temp)));
 
 #if HIVEC_DEBUG
 						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
@@ -793,68 +924,41 @@ signed char Validator_validateTokens(
 						return 0;
 					}
 
-					for (signed int i = 0; i < 5; ++i)
-					{
-						Stack_pop(&stack);
-					}
-
-					Stack_push(&stack, &I64_VALUE_TYPE);
-				} break;
+					const unsigned char type = stack->types[stack->count - 1 - depth];
 
-				case TOKEN_INTRINSIC_SYSCALL5:
-				{
-					if (stack.count <= 5)
+					if (tokens->kinds[temp] == TOKEN_KEYWORD_I64)
 					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 6 arguments to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
+						if (type != VALUE_TYPE_I64)
+						{
+							Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, Tokens_location(tokens, temp), "encountered an invalid type! Expected an `%.*s` type to be on the stack!", (signed int)tokens->lengths[temp], Tokens_source(tokens, temp)));
 
 #if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
+							Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+								(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+								"locator of the log above this meesage."));
 #endif
 
-						return 0;
-					}
-
-					for (signed int i = 0; i < 6; ++i)
-					{
-						Stack_pop(&stack);
+							return 0;
+						}
 					}
-
-					Stack_push(&stack, &I64_VALUE_TYPE);
-				} break;
-
-				case TOKEN_INTRINSIC_SYSCALL6:
-				{
-					if (stack.count <= 6)
+					else if (tokens->kinds[temp] == TOKEN_KEYWORD_P64)
 					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 7 arguments to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
+						if (type != VALUE_TYPE_P64)
+						{
+							Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, Tokens_location(tokens, temp), "encountered an invalid type! Expected a `%.*s` type to be on the stack!", (signed int)tokens->lengths[temp], Tokens_source(tokens, temp)));
 
 #if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
+							Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+								(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+								"locator of the log above this meesage."));
 #endif
 
-						return 0;
-					}
-
-					for (signed int i = 0; i < 7; ++i)
-					{
-						Stack_pop(&stack);
+							return 0;
+						}
 					}
-
-					Stack_push(&stack, &I64_VALUE_TYPE);
-				} break;
-
-				case TOKEN_INTRINSIC_CLONE:
-				{
-					if (stack.count <= 0)
+					else
 					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 1 argument to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
+						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, Tokens_location(tokens, temp), "encountered an invalid token `%.*s` in place of a type specifier!", (signed int)tokens->lengths[temp], Tokens_source(tokens, temp)));
 
 #if HIVEC_DEBUG
 						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
@@ -864,18 +968,23 @@ signed char Validator_validateTokens(
 
 						return 0;
 					}
+				}
 
-					int64_t a = *(int64_t*)Stack_pop(&stack);
-					Stack_push(&stack, &a);
-					Stack_push(&stack, &a);
-				} break;
+				ValidatorStack_drop(stack, argumentsCount);
 
-				case TOKEN_INTRINSIC_DROP:
+				for (int64_t temp = calledProcedure->returnedTypes.begin; temp < calledProcedure->returnedTypes.end; ++temp)
 				{
-					if (stack.count <= 0)
+					if (tokens->kinds[temp] == TOKEN_KEYWORD_I64)
 					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 1 argument to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
+						ValidatorStack_push(stack, VALUE_TYPE_I64);
+					}
+					else if (tokens->kinds[temp] == TOKEN_KEYWORD_P64)
+					{
+						ValidatorStack_push(stack, VALUE_TYPE_P64);
+					}
+					else
+					{
+						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, Tokens_location(tokens, temp), "encountered an invalid token `%.*s` in place of a type specifier!", (signed int)tokens->lengths[temp], Tokens_source(tokens, temp)));
 
 #if HIVEC_DEBUG
 						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
@@ -885,303 +994,239 @@ signed char Validator_validateTokens(
 
 						return 0;
 					}
+				}
+			} break;
 
-					Stack_pop(&stack);
-				} break;
+			case OPCODE_RETURN:
+			{
+			} break;
 
-				case TOKEN_INTRINSIC_OVER:
+			default:
+			{
+				// NOTE: using `assert` and not `if`
+				// REASONS:
+				//     1. All other opcodes are intrinsics, and every intrinsic must have its
+				//        signature, which pops at least one argument.
+				//     2. This assert will prevent developers infliced bugs and development
+				//        and debug configuration.
+				assert(instruction->opcode >= OPCODE_FIRST_INTRINSIC && instruction->opcode <= OPCODE_LAST_INTRINSIC &&
+					signatures[instruction->opcode - OPCODE_FIRST_INTRINSIC].inputsCount > 0);
+
+				const struct ValidatorSignature* signature = &signatures[instruction->opcode - OPCODE_FIRST_INTRINSIC];
+
+				if (stack->count < signature->inputsCount)
 				{
-					if (stack.count <= 1)
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 2 arguments to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
+					Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, Tokens_location(tokens, token), "`%.*s` %s requires %d argument%s to be on the stack!",
+						(signed int)tokens->lengths[token], Tokens_source(tokens, token), signature->kind, (signed int)signature->inputsCount, signature->inputsCount == 1 ? "" : "s"));
 
 #if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
+					Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+						(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+						"locator of the log above this meesage."));
 #endif
 
-						return 0;
-					}
-
-					int64_t b = *(int64_t*)Stack_pop(&stack);
-					int64_t a = *(int64_t*)Stack_pop(&stack);
+					return 0;
+				}
 
-					Stack_push(&stack, &a);
-					Stack_push(&stack, &b);
-					Stack_push(&stack, &a);
-				} break;
+				const unsigned char* inputs = &stack->types[stack->count - signature->inputsCount];
+				int64_t combination = 0;
 
-#if HIVEC_DEBUG
-// TODO: remove:
-				case TOKEN_INTRINSIC_PRINTN:
+				for (int64_t input = signature->inputsCount - signature->checkedCount; input < signature->inputsCount; ++input)
 				{
-					if (stack.count <= 0)
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` dev-intrinsic requires 1 argument to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
-
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
-
-						return 0;
-					}
+					combination = (combination << 1) | inputs[input];
+				}
 
-					Stack_pop(&stack);
-				} break;
-#endif
+				const unsigned char result = signature->results[combination];
 
-				case TOKEN_INTRINSIC_SWAP:
+				if (result == VALIDATOR_REJECTED)
 				{
-					if (stack.count <= 1)
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "`%.*s` intrinsic requires 2 arguments to be on the stack!",
-							(signed int)token->source.length, token->source.buffer));
+					Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, Tokens_location(tokens, token), "`%.*s` %s only supports %s of arguments!",
+						(signed int)tokens->lengths[token], Tokens_source(tokens, token), signature->kind, signature->supported));
 
 #if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
+					Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+						(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+						"locator of the log above this meesage."));
 #endif
 
-						return 0;
-					}
-
-					int64_t b = *(int64_t*)Stack_pop(&stack);
-					int64_t a = *(int64_t*)Stack_pop(&stack);
+					return 0;
+				}
 
-					Stack_push(&stack, &b);
-					Stack_push(&stack, &a);
-				} break;
+				// NOTE: the outputs are gathered aside, since they can copy the inputs, that
+				//       they overwrite.
+				unsigned char outputs[VALIDATOR_MAXIMAL_OUTPUTS_COUNT];
 
-				case TOKEN_LITERAL_I64:
+				for (int64_t output = 0; output < signature->outputsCount; ++output)
 				{
-					Stack_push(&stack, &I64_VALUE_TYPE);
-				} break;
+					const unsigned char source = signature->outputs[output];
+					outputs[output] = source == VALIDATOR_OUTPUT_RESULT ? result : inputs[source - VALIDATOR_OUTPUT_INPUT(0)];
+				}
 
-				case TOKEN_LITERAL_STRING:
-				{
-					Stack_push(&stack, &I64_VALUE_TYPE);
-					Stack_push(&stack, &P64_VALUE_TYPE);
-				} break;
+				ValidatorStack_drop(stack, signature->inputsCount);
 
-				case TOKEN_IDENTIFIER:
+				for (int64_t output = 0; output < signature->outputsCount; ++output)
 				{
-					struct Procedure* calledProcedure = NULL;
-
-					for (struct LNode* proceduresIterator2 = globals->procedures.front; proceduresIterator2 != NULL; proceduresIterator2 = proceduresIterator2->next)
-					{
-						// NOTE: using `assert` and not `if`
-						// REASONS:
-						//     1. The procedures second iterator's data, in the list must never be
-						//        of value null.
-						//     2. This assert will prevent developers infliced bugs and development
-						//        and debug configuration.
-						assert(proceduresIterator2->data != NULL);
-
-						struct Procedure* temp = (struct Procedure*)proceduresIterator2->data;
-
-						if (token->source.length == temp->name->source.length
-						 && strncmp(token->source.buffer, temp->name->source.buffer, token->source.length) == 0)
-						{
-							calledProcedure = temp;
-							break;
-						}
-					}
-
-					if (calledProcedure == NULL)
-					{
-						Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "encountered undefined procedure `%.*s`!", (signed int)token->source.length, token->source.buffer));
-
-#if HIVEC_DEBUG
-						Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-							(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-							"locator of the log above this meesage."));
-#endif
-
-						return 0;
-					}
-
-					for (struct LNode* requiredTypesIterator = calledProcedure->requiredTypes.front; requiredTypesIterator != NULL; requiredTypesIterator = requiredTypesIterator->next)
-					{
-						// NOTE: using `assert` and not `if`
-						// REASONS:
-						//     1. The required types iterator's data, in the list must never be
-						//        of value null.
-						//     2. This assert will prevent developers infliced bugs and development
-						//        and debug configuration.
-						assert(requiredTypesIterator->data != NULL);
+					ValidatorStack_push(stack, outputs[output]);
+				}
+			} break;
+		}
 
-						struct Token* temp = (struct Token*)requiredTypesIterator->data;
+		if (stack->count > procedure->stackDepth)
+		{
+			procedure->stackDepth = stack->count;
+		}
+	}
 
-						if (stack.count <= 0)
-						{
-							Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, temp->location, "expected a `%.*s` type to be on the stack, but the stack was empty!", (signed int)temp->source.length, temp->source.buffer));
+	for (int64_t token = procedure->returnedTypes.begin; token < procedure->returnedTypes.end; ++token)
+	{
+		if (stack->count <= 0)
+		{
+			Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, Tokens_location(tokens, token), "expected `%.*s` type to be on the stack, but stack is empty!", (signed int)tokens->lengths[token], Tokens_source(tokens, token)));
 
 #if HIVEC_DEBUG
-							Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-								(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-								"locator of the log above this meesage."));
+			Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+				(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+				"locator of the log above this meesage."));
 #endif
 
-							return 0;
-						}
+			return 0;
+		}
 
-						int64_t type = *(int64_t*)Stack_pop(&stack);
+		const unsigned char a = ValidatorStack_peek(stack);
 
-						if (temp->kind == TOKEN_KEYWORD_I64)
-						{
-							if (type != I64_VALUE_TYPE)
-							{
-								Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, temp->location, "encountered an invalid type! Expected an `%.*s` type to be on the stack!", (signed int)temp->source.length, temp->source.buffer));
+		if (a == VALUE_TYPE_I64 && tokens->kinds[token] == TOKEN_KEYWORD_I64)
+		{
+			ValidatorStack_pop(stack);
+		}
+		else if (a == VALUE_TYPE_P64 && tokens->kinds[token] == TOKEN_KEYWORD_P64)
+		{
+			ValidatorStack_pop(stack);
+		}
+		else
+		{
+			Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, Tokens_location(tokens, token), "expected `%.*s` type to be on the stack, but stack is empty!", (signed int)tokens->lengths[token], Tokens_source(tokens, token)));
 
 #if HIVEC_DEBUG
-								Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-									(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-									"locator of the log above this meesage."));
+			Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+				(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+				"locator of the log above this meesage."));
 #endif
 
-								return 0;
-							}
-						}
-						else if (temp->kind == TOKEN_KEYWORD_P64)
-						{
-							if (type != P64_VALUE_TYPE)
-							{
-								Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, temp->location, "encountered an invalid type! Expected a `%.*s` type to be on the stack!", (signed int)temp->source.length, temp->source.buffer));
-
-#if HIVEC_DEBUG
-								Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-									(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-									"locator of the log above this meesage."));
-#endif
+			return 0;
+		}
+	}
 
-								return 0;
-							}
-						}
-						else
-						{
-							Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, temp->location, "encountered an invalid token `%.*s` in place of a type specifier!", (signed int)temp->source.length, temp->source.buffer));
+	if (stack->count > 0)
+	{
+		Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, Tokens_location(tokens, procedure->name), "procedure's `%.*s` stack has an overflow!", (signed int)tokens->lengths[procedure->name], Tokens_source(tokens, procedure->name)));
 
 #if HIVEC_DEBUG
-							Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-								(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-								"locator of the log above this meesage."));
+		Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
+			(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
+			"locator of the log above this meesage."));
 #endif
 
-							return 0;
-						}
-					}
-
-					for (struct LNode* returnedTypesIterator = calledProcedure->returnedTypes.front; returnedTypesIterator != NULL; returnedTypesIterator = returnedTypesIterator->next)
-					{
-						// NOTE: using `assert` and not `if`
-						// REASONS:
-						//     1. The returned types iterator's data, in the list must never be
-						//        of value null.
-						//     2. This assert will prevent developers infliced bugs and development
-						//        and debug configuration.
-						assert(returnedTypesIterator->data != NULL);
+		return 0;
+	}
 
-						struct Token* temp = (struct Token*)returnedTypesIterator->data;
+	return 1;
+}
 
-						if (temp->kind == TOKEN_KEYWORD_I64)
-						{
-							Stack_push(&stack, &I64_VALUE_TYPE);
-						}
-						else if (temp->kind == TOKEN_KEYWORD_P64)
-						{
-							Stack_push(&stack, &P64_VALUE_TYPE);
-						}
-						else
-						{
-							Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, temp->location, "encountered an invalid token `%.*s` in place of a type specifier!", (signed int)temp->source.length, temp->source.buffer));
+static void* Validator_work(
+	void* const data)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The worker, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(data != NULL);
 
-#if HIVEC_DEBUG
-							Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-								(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-								"locator of the log above this meesage."));
-#endif
+	struct ValidatorWorker* worker = (struct ValidatorWorker*)data;
+	struct ValidatorPool* pool = worker->pool;
 
-							return 0;
-						}
-					}
-				} break;
+	// NOTE: the procedures are claimed in the definition order, so once the claimed one
+	//       follows a failed one, so do all the remaining ones, and their diagnostics would be
+	//       dropped anyway.
+	for (;;)
+	{
+		const int64_t index = (int64_t)atomic_fetch_add(&pool->next, 1);
 
-				default:
-				{
-				} break;
-			}
+		if (index >= pool->proceduresCount || index > (int64_t)atomic_load(&pool->failed))
+		{
+			break;
 		}
 
-		for (struct LNode* returnedTypesIterator = procedure->returnedTypes.front; returnedTypesIterator != NULL; returnedTypesIterator = returnedTypesIterator->next)
+		if (!Validator_validateProcedure(pool->globals, pool->procedures[index], &worker->stack, &worker->joins, &pool->logs[index]))
 		{
-			// NOTE: using `assert` and not `if`
-			// REASONS:
-			//     1. The returned types iterator's data, in the list must never be of
-			//        value null.
-			//     2. This assert will prevent developers infliced bugs and development
-			//        and debug configuration.
-			assert(returnedTypesIterator->data != NULL);
-
-			struct Token* token = (struct Token*)returnedTypesIterator->data;
+			int_fast64_t failed = atomic_load(&pool->failed);
 
-			if (stack.count <= 0)
+			while (index < (int64_t)failed && !atomic_compare_exchange_weak(&pool->failed, &failed, index))
 			{
-				Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "expected `%.*s` type to be on the stack, but stack is empty!", (signed int)token->source.length, token->source.buffer));
+			}
+		}
+	}
 
-#if HIVEC_DEBUG
-				Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-					(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-					"locator of the log above this meesage."));
-#endif
+	return NULL;
+}
 
-				return 0;
-			}
+#if HIVEC_DEBUG
+static void Validator_checkSignatures(
+	void)
+{
+	static signed char checked = 0;
 
-			int64_t a = *(int64_t*)Stack_peek(&stack, 0);
+	if (checked)
+	{
+		return;
+	}
 
-			if (a == I64_VALUE_TYPE && token->kind == TOKEN_KEYWORD_I64)
-			{
-				Stack_pop(&stack);
-			}
-			else if (a == P64_VALUE_TYPE && token->kind == TOKEN_KEYWORD_P64)
-			{
-				Stack_pop(&stack);
-			}
-			else
-			{
-				Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, token->location, "expected `%.*s` type to be on the stack, but stack is empty!", (signed int)token->source.length, token->source.buffer));
+	for (int64_t opcode = OPCODE_FIRST_INTRINSIC; opcode <= OPCODE_LAST_INTRINSIC; ++opcode)
+	{
+		// NOTE: using `assert` and not `if`
+		// REASONS:
+		//     1. Every intrinsic opcode must have its row in the `signatures` set, otherwise
+		//        the set was not updated together with the opcodes enum.
+		//     2. This assert will prevent developers infliced bugs and development
+		//        and debug configuration.
+		assert(signatures[opcode - OPCODE_FIRST_INTRINSIC].kind != NULL);
+	}
 
-#if HIVEC_DEBUG
-				Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-					(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-					"locator of the log above this meesage."));
+	checked = 1;
+}
 #endif
 
-				return 0;
-			}
-		}
+static int64_t Validator_countWorkers(
+	const struct Globals* const globals,
+	const int64_t threadsCount)
+{
+	// NOTE: using `assert` and not `if`
+	// REASONS:
+	//     1. The globals, provided to this function, must never ever be null.
+	//     2. This assert will prevent developers infliced bugs and development
+	//        and debug configuration.
+	assert(globals != NULL);
 
-		if (stack.count > 0)
-		{
-			Queue_enqueue(logs, Log_create("validator", SEVERITY_ERROR, procedure->name->location, "procedure's `%.*s` stack has an overflow!", (signed int)procedure->name->source.length, procedure->name->source.buffer));
+	int64_t instructionsCount = 0;
 
-#if HIVEC_DEBUG
-			Queue_enqueue(logs, Log_create("debug", SEVERITY_WARNING,
-				(struct Location) { .file = (const char*)__FILE__, .line = (int64_t)__LINE__, .column = 0 },
-				"locator of the log above this meesage."));
-#endif
+	for (int64_t index = 0; index < globals->procedures.count; ++index)
+	{
+		instructionsCount += ((const struct Procedure*)List_at(&globals->procedures, index))->instructionsCount;
+	}
 
-			return 0;
-		}
+	int64_t workersCount = instructionsCount / VALIDATOR_MINIMAL_INSTRUCTIONS_PER_WORKER;
+
+	if (workersCount > threadsCount)
+	{
+		workersCount = threadsCount;
 	}
 
-	return 1;
+	if (workersCount > VALIDATOR_MAXIMAL_WORKERS_COUNT)
+	{
+		workersCount = VALIDATOR_MAXIMAL_WORKERS_COUNT;
+	}
+
+	return workersCount > 1 ? workersCount : 1;
 }
 
 /**
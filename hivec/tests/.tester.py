@@ -7,6 +7,8 @@ import argparse
 import subprocess
 import shlex
 import filecmp
+import struct
+import tempfile
 
 
 class Style():
@@ -56,6 +58,37 @@ with open(settings_file_path, 'r') as settings_file:
 	settings = json.load(settings_file)
 
 
+# Damages of a stored token cache, every one of which must make the compiler reject the cache and
+# lex the source again. The offsets follow the `struct CacheHeader` in source/cache.c.
+def damage_version(cache):
+	cache[8:12] = struct.pack('<I', struct.unpack('<I', cache[8:12])[0] + 1)
+
+def damage_kinds_count(cache):
+	cache[16:20] = struct.pack('<I', struct.unpack('<I', cache[16:20])[0] + 1)
+
+def damage_payload(cache):
+	kinds = struct.unpack('<q', cache[72:80])[0]
+	cache[kinds] = 0xff
+
+def damage_length(cache):
+	del cache[len(cache) // 2:]
+
+cache_damages = {
+	'stale version': damage_version,
+	'kinds count mismatch': damage_kinds_count,
+	'damaged payload': damage_payload,
+	'truncated': damage_length,
+}
+
+
+def read_file(path):
+	if not os.path.isfile(path):
+		return None
+
+	with open(path, 'rb') as f:
+		return f.read()
+
+
 # Performing tests
 passed = 0
 failed = 0
@@ -93,38 +126,159 @@ for file in os.listdir('./'):
 		print(f'Test {test_name} was set to be excluded in the settings. Skipping...')
 		continue
 
-	print(f'Testing {source_file}:')
+	# Every test is compiled with the default pipeline, and the streamed ones are compiled once
+	# more with the `--stream` flag, which must produce a program of the same behaviour
+	variants = [ [ ] ]
 
-	subprocess.run([ settings['hivec'], '-o', os.path.abspath(intermediate_file), os.path.abspath(source_file) ])
-	subprocess.run([ 'nasm', '-felf64', os.path.abspath(intermediate_file) ])
-	subprocess.run([ 'ld', '-o', os.path.abspath(output_file), os.path.abspath(object_file) ])
+	if test_config.get('stream', False):
+		variants.append([ '--stream' ])
 
-	temp_extention         = '.hlang.temp'
-	temp_file              = f'{test_path}{temp_extention}'
+	for flags in variants:
+		print(f'Testing {source_file}' + (f' ({" ".join(flags)})' if len(flags) > 0 else '') + ':')
 
-	subprocess.run([ 'touch', os.path.abspath(temp_file) ])
-	with open(temp_file, 'w') as f:
-		subprocess.run([ os.path.abspath(output_file), *test_config['args'] ], stdout=f, stderr=subprocess.DEVNULL)
+		if os.path.isfile(intermediate_file):
+			subprocess.run([ 'rm', '-f', os.path.abspath(intermediate_file) ])
 
-	if filecmp.cmp(expected_file, temp_file):
-		print(Style.GREEN + ' Passed' + Style.RESET)
-		passed += 1
-	else:
-		print(Style.RED + ' Failed' + Style.RESET)
-		failed += 1
+		subprocess.run([ settings['hivec'], *flags, '-o', os.path.abspath(intermediate_file), os.path.abspath(source_file) ])
 
-	if test_config['cleanup']:
-		if os.path.isfile(temp_file):
-			subprocess.run([ 'rm', '-f', os.path.abspath(temp_file) ])
+		# Rejected tests must fail to compile, so no intermediate file is translated and there is
+		# no program to run
+		if test_config.get('rejected', False):
+			if not os.path.isfile(intermediate_file):
+				print(Style.GREEN + ' Passed' + Style.RESET)
+				passed += 1
+			else:
+				print(Style.RED + ' Failed' + Style.RESET)
+				failed += 1
 
-		if os.path.isfile(intermediate_file):
+			if test_config['cleanup'] and os.path.isfile(intermediate_file):
+				subprocess.run([ 'rm', '-f', os.path.abspath(intermediate_file) ])
+
+			continue
+
+		subprocess.run([ 'nasm', '-felf64', os.path.abspath(intermediate_file) ])
+		subprocess.run([ 'ld', '-o', os.path.abspath(output_file), os.path.abspath(object_file) ])
+
+		temp_extention         = '.hlang.temp'
+		temp_file              = f'{test_path}{temp_extention}'
+
+		subprocess.run([ 'touch', os.path.abspath(temp_file) ])
+		with open(temp_file, 'w') as f:
+			subprocess.run([ os.path.abspath(output_file), *test_config['args'] ], stdout=f, stderr=subprocess.DEVNULL)
+
+		if filecmp.cmp(expected_file, temp_file):
+			print(Style.GREEN + ' Passed' + Style.RESET)
+			passed += 1
+		else:
+			print(Style.RED + ' Failed' + Style.RESET)
+			failed += 1
+
+		if test_config['cleanup']:
+			if os.path.isfile(temp_file):
+				subprocess.run([ 'rm', '-f', os.path.abspath(temp_file) ])
+
+			if os.path.isfile(intermediate_file):
+				subprocess.run([ 'rm', '-f', os.path.abspath(intermediate_file) ])
+
+			if os.path.isfile(object_file):
+				subprocess.run([ 'rm', '-f', os.path.abspath(object_file) ])
+
+			if os.path.isfile(output_file):
+				subprocess.run([ 'rm', '-f', os.path.abspath(output_file) ])
+
+	# Cached tests are compiled through a temporary cache directory: the first compilation stores
+	# the tokens, the second one loads them, and every damaged cache must be rejected in favour of
+	# lexing the source again. All of them must translate the very same intermediate file, as the
+	# compilation without the cache does.
+	if test_config.get('cache', False):
+		print(f'Testing {source_file} (--cache):')
+
+		def compile_cached(cache_directory):
+			if os.path.isfile(intermediate_file):
+				subprocess.run([ 'rm', '-f', os.path.abspath(intermediate_file) ])
+
+			flags = [ ] if cache_directory is None else [ '--cache', cache_directory ]
+			subprocess.run([ settings['hivec'], *flags, '-o', os.path.abspath(intermediate_file), os.path.abspath(source_file) ])
+			return read_file(intermediate_file)
+
+		expected = compile_cached(None)
+		matching = True
+
+		with tempfile.TemporaryDirectory() as cache_directory:
+			matching = compile_cached(cache_directory) == expected and compile_cached(cache_directory) == expected
+			caches = os.listdir(cache_directory)
+			matching = matching and len(caches) == 1
+
+			if matching:
+				cache_file = os.path.join(cache_directory, caches[0])
+				stored = read_file(cache_file)
+
+				for name, damage in cache_damages.items():
+					cache = bytearray(stored)
+					damage(cache)
+
+					with open(cache_file, 'wb') as f:
+						f.write(cache)
+
+					# The source is lexed again and its tokens are stored over the damaged cache
+					if compile_cached(cache_directory) != expected or read_file(cache_file) != stored:
+						print(f' The {name} cache was not rejected')
+						matching = False
+
+		if matching:
+			print(Style.GREEN + ' Passed' + Style.RESET)
+			passed += 1
+		else:
+			print(Style.RED + ' Failed' + Style.RESET)
+			failed += 1
+
+		if test_config['cleanup'] and os.path.isfile(intermediate_file):
 			subprocess.run([ 'rm', '-f', os.path.abspath(intermediate_file) ])
 
-		if os.path.isfile(object_file):
-			subprocess.run([ 'rm', '-f', os.path.abspath(object_file) ])
+# Generated tests are sources, too big to be kept in the repository, that the bench-generator
+# generates with the provided options. Every one of them is compiled with every threads count in
+# jobs, and all of them must print the very same diagnostics and translate the very same
+# intermediate file, as the compilation on one thread does.
+for test_name, test_config in settings['tests'].items():
+	if 'generate' not in test_config:
+		continue
 
-		if os.path.isfile(output_file):
-			subprocess.run([ 'rm', '-f', os.path.abspath(output_file) ])
+	if test_config['exclude']:
+		print(f'Test {test_name} was set to be excluded in the settings. Skipping...')
+		continue
+
+	print(f'Testing {test_name} (generated):')
+
+	with tempfile.TemporaryDirectory() as directory:
+		source_file = os.path.join(directory, f'{test_name}{settings["extentions"]["source"]}')
+		subprocess.run([ settings['generator'], *test_config['generate'], '--output', source_file ])
+
+		results = [ ]
+
+		for jobs in test_config['jobs']:
+			intermediate_file = os.path.join(directory, f'{test_name}.{jobs}{settings["extentions"]["intermediate"]}')
+			compilation = subprocess.run([ settings['hivec'], '--jobs', f'{jobs}', '-o', intermediate_file, source_file ], stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+			results.append((jobs, compilation.stdout, read_file(intermediate_file)))
+
+	matching = True
+	_, expected_logs, expected_intermediate = results[0]
+
+	# Rejected tests must fail to compile, so no intermediate file is translated
+	if len(expected_logs) <= 0 or (expected_intermediate is None) != test_config.get('rejected', False):
+		print(f' The compilation with --jobs {results[0][0]} was not {"rejected" if test_config.get("rejected", False) else "accepted"}')
+		matching = False
+
+	for jobs, logs, intermediate in results[1:]:
+		if logs != expected_logs or intermediate != expected_intermediate:
+			print(f' The compilation with --jobs {jobs} did not match the one with --jobs {results[0][0]}')
+			matching = False
+
+	if matching:
+		print(Style.GREEN + ' Passed' + Style.RESET)
+		passed += 1
+	else:
+		print(Style.RED + ' Failed' + Style.RESET)
+		failed += 1
 
 print('Results:')
 print(' ' + Style.GREEN + f'{passed}' + ' tests passed' + Style.RESET + ', ' + Style.RED + f'{failed}' + ' tests failed' + Style.RESET)